@@ -172,6 +172,8 @@ static Bit16u MulTable[ 384 ];
 
 static Bit8u KslTable[ 8 * 16 ];
 static Bit8u TremoloTable[ TREMOLO_TABLE ];
+//Result of clocking the lowest 8 bits of the noise generator 8 times
+static Bit32u NoiseTable[ 256 ];
 //Start of a channel behind the chip struct start
 static Bit16u ChanOffsetTable[32];
 //Start of an operator behind the chip struct start
@@ -595,6 +597,48 @@ INLINE Bits Operator::GetSample( Bits modulation ) {
 	}
 }
 
+template< bool modulated >
+void Operator::GenerateBlock( Bitu samples, const Bit32s* modulation, Bit32s* output ) {
+	Bit32u index = waveIndex;
+	if ( state == OFF || ( state == SUSTAIN && ( reg20 & MASK_SUSTAIN ) ) ) {
+		//The envelope is steady for the entire block
+		Bitu vol = ForwardVolume();
+		if ( ENV_SILENT( vol ) ) {
+			//Simply forward the wave
+			waveIndex = index + waveCurrent * samples;
+			memset( output, 0, sizeof( Bit32s ) * samples );
+			return;
+		}
+#if ( DBOPL_WAVE == WAVE_TABLEMUL )
+		//Without envelope changes the block is a plain phase accumulator and table lookup
+		const Bit16s* base = waveBase;
+		const Bit32u mask = waveMask;
+		const Bit32s mul = MulTable[ vol >> ENV_EXTRA ];
+		const Bit32u add = waveCurrent;
+		for ( Bitu i = 0; i < samples; i++ ) {
+			index += add;
+			Bit32u wave = index >> WAVE_SH;
+			if ( modulated )
+				wave += modulation[ i ];
+			output[ i ] = ( base[ wave & mask ] * mul ) >> MUL_SH;
+		}
+#else
+		for ( Bitu i = 0; i < samples; i++ ) {
+			index += waveCurrent;
+			Bitu wave = index >> WAVE_SH;
+			if ( modulated )
+				wave += modulation[ i ];
+			output[ i ] = GetWave( wave, vol );
+		}
+#endif
+		waveIndex = index;
+		return;
+	}
+	for ( Bitu i = 0; i < samples; i++ ) {
+		output[ i ] = GetSample( modulated ? modulation[ i ] : 0 );
+	}
+}
+
 Operator::Operator() {
 	chanData = 0;
 	freqMul = 0;
@@ -911,49 +955,68 @@ Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
 		Op( 4 )->Prepare( chip );
 		Op( 5 )->Prepare( chip );
 	}
-	for ( Bitu i = 0; i < samples; i++ ) {
-		//Early out for percussion handlers
-		if ( mode == sm2Percussion ) {
+	//Early out for percussion handlers
+	if ( mode == sm2Percussion ) {
+		for ( Bitu i = 0; i < samples; i++ )
 			GeneratePercussion<false>( chip, output + i );
-			continue;	//Prevent some unitialized value bitching
-		} else if ( mode == sm3Percussion ) {
+		return( this + 3 );
+	} else if ( mode == sm3Percussion ) {
+		for ( Bitu i = 0; i < samples; i++ )
 			GeneratePercussion<true>( chip, output + i * 2 );
-			continue;	//Prevent some unitialized value bitching
+		return( this + 3 );
+	}
+	//The operators only share state through their outputs, so instead of
+	//running the whole chain per sample every operator generates a chunk of
+	//samples at a time. Only the feedback operator has to go sample by sample.
+	Bit32s out0[ BLOCK_CHUNK ];
+	Bit32s next[ BLOCK_CHUNK ];
+	Bit32s sample[ BLOCK_CHUNK ];
+	for ( Bitu done = 0; done < samples; ) {
+		Bitu todo = samples - done;
+		if ( todo > BLOCK_CHUNK )
+			todo = BLOCK_CHUNK;
+		for ( Bitu i = 0; i < todo; i++ ) {
+			//Do unsigned shift so we can shift out all bits but still stay in 10 bit range otherwise
+			Bit32s mod = (Bit32u)((old[0] + old[1])) >> feedback;
+			old[0] = old[1];
+			old[1] = Op(0)->GetSample( mod );
+			out0[ i ] = old[0];
 		}
-
-		//Do unsigned shift so we can shift out all bits but still stay in 10 bit range otherwise
-		Bit32s mod = (Bit32u)((old[0] + old[1])) >> feedback;
-		old[0] = old[1];
-		old[1] = Op(0)->GetSample( mod );
-		Bit32s sample;
-		Bit32s out0 = old[0];
 		if ( mode == sm2AM || mode == sm3AM ) {
-			sample = out0 + Op(1)->GetSample( 0 );
+			Op(1)->GenerateBlock< false >( todo, 0, sample );
+			for ( Bitu i = 0; i < todo; i++ )
+				sample[ i ] += out0[ i ];
 		} else if ( mode == sm2FM || mode == sm3FM ) {
-			sample = Op(1)->GetSample( out0 );
+			Op(1)->GenerateBlock< true >( todo, out0, sample );
 		} else if ( mode == sm3FMFM ) {
-			Bits next = Op(1)->GetSample( out0 );
-			next = Op(2)->GetSample( next );
-			sample = Op(3)->GetSample( next );
+			Op(1)->GenerateBlock< true >( todo, out0, next );
+			Op(2)->GenerateBlock< true >( todo, next, next );
+			Op(3)->GenerateBlock< true >( todo, next, sample );
 		} else if ( mode == sm3AMFM ) {
-			sample = out0;
-			Bits next = Op(1)->GetSample( 0 );
-			next = Op(2)->GetSample( next );
-			sample += Op(3)->GetSample( next );
+			Op(1)->GenerateBlock< false >( todo, 0, next );
+			Op(2)->GenerateBlock< true >( todo, next, next );
+			Op(3)->GenerateBlock< true >( todo, next, sample );
+			for ( Bitu i = 0; i < todo; i++ )
+				sample[ i ] += out0[ i ];
 		} else if ( mode == sm3FMAM ) {
-			sample = Op(1)->GetSample( out0 );
-			Bits next = Op(2)->GetSample( 0 );
-			sample += Op(3)->GetSample( next );
+			Op(1)->GenerateBlock< true >( todo, out0, sample );
+			Op(2)->GenerateBlock< false >( todo, 0, next );
+			Op(3)->GenerateBlock< true >( todo, next, next );
+			for ( Bitu i = 0; i < todo; i++ )
+				sample[ i ] += next[ i ];
 		} else if ( mode == sm3AMAM ) {
-			sample = out0;
-			Bits next = Op(1)->GetSample( 0 );
-			sample += Op(2)->GetSample( next );
-			sample += Op(3)->GetSample( 0 );
+			Op(1)->GenerateBlock< false >( todo, 0, next );
+			Op(2)->GenerateBlock< true >( todo, next, sample );
+			Op(3)->GenerateBlock< false >( todo, 0, next );
+			for ( Bitu i = 0; i < todo; i++ )
+				sample[ i ] += out0[ i ] + next[ i ];
 		}
 		switch( mode ) {
 		case sm2AM:
 		case sm2FM:
-			output[ i ] += sample;
+			for ( Bitu i = 0; i < todo; i++ )
+				output[ i ] += sample[ i ];
+			output += todo;
 			break;
 		case sm3AM:
 		case sm3FM:
@@ -961,30 +1024,20 @@ Channel* Channel::BlockTemplate( Chip* chip, Bit32u samples, Bit32s* output ) {
 		case sm3AMFM:
 		case sm3FMAM:
 		case sm3AMAM:
-			output[ i * 2 + 0 ] += sample & maskLeft;
-			output[ i * 2 + 1 ] += sample & maskRight;
+			for ( Bitu i = 0; i < todo; i++ ) {
+				output[ i * 2 + 0 ] += sample[ i ] & maskLeft;
+				output[ i * 2 + 1 ] += sample[ i ] & maskRight;
+			}
+			output += todo * 2;
 			break;
 		case sm2Percussion:
-			// This case was not handled in the DOSBox code either
-			// thus we leave this blank.
-			// TODO: Consider checking this.
-			break;
 		case sm3Percussion:
-			// This case was not handled in the DOSBox code either
-			// thus we leave this blank.
-			// TODO: Consider checking this.
-			break;
 		case sm4Start:
-			// This case was not handled in the DOSBox code either
-			// thus we leave this blank.
-			// TODO: Consider checking this.
-			break;
 		case sm6Start:
-			// This case was not handled in the DOSBox code either
-			// thus we leave this blank.
-			// TODO: Consider checking this.
+			// Handled above or never used as a synth handler
 			break;
 		}
+		done += todo;
 	}
 	switch( mode ) {
 	case sm2AM:
@@ -1030,6 +1083,11 @@ INLINE Bit32u Chip::ForwardNoise() {
 	noiseCounter += noiseAdd;
 	Bitu count = noiseCounter >> LFO_SH;
 	noiseCounter &= WAVE_MASK;
+	//The generator is linear and the upper bits only shift down while the lowest
+	//bits are clocked out, so 8 steps at a time can be taken from a table
+	for ( ; count >= 8; count -= 8 ) {
+		noiseValue = ( noiseValue >> 8 ) ^ NoiseTable[ noiseValue & 0xff ];
+	}
 	for ( ; count > 0; --count ) {
 		//Noise calculation from mame
 		noiseValue ^= ( 0x800302 ) & ( 0 - (noiseValue & 1 ) );
@@ -1463,6 +1521,15 @@ void InitTables( void ) {
 		TremoloTable[i] = val;
 		TremoloTable[TREMOLO_TABLE - 1 - i] = val;
 	}
+	//Create the table to forward the noise generator 8 steps at once
+	for ( Bit32u i = 0; i < 256; i++ ) {
+		Bit32u value = i;
+		for ( int step = 0; step < 8; step++ ) {
+			value ^= ( 0x800302 ) & ( 0 - (value & 1 ) );
+			value >>= 1;
+		}
+		NoiseTable[i] = value;
+	}
 	//Create a table with offsets of the channels from the start of the chip
 	DBOPL::Chip* chip = 0;
 	for ( Bitu i = 0; i < 32; i++ ) {
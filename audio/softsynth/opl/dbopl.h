@@ -91,6 +91,11 @@ enum {
 	SHIFT_KEYCODE = 24
 };
 
+//Amount of samples each operator generates in one go
+enum {
+	BLOCK_CHUNK = 64
+};
+
 struct Operator {
 public:
 	//Masks for operator 20 values
@@ -178,6 +183,9 @@ public:
 
 	Bits GetSample( Bits modulation );
 	Bits GetWave( Bitu index, Bitu vol );
+	//Generate a block of at most BLOCK_CHUNK samples, optionally phase modulated by another block
+	template< bool modulated >
+	void GenerateBlock( Bitu samples, const Bit32s* modulation, Bit32s* output );
 public:
 	Operator();
 };
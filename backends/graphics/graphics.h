@@ -65,6 +65,7 @@ public:
 	virtual void unlockScreen() = 0;
 	virtual void fillScreen(uint32 col) = 0;
 	virtual void updateScreen() = 0;
+	virtual bool getFrameStatistics(OSystem::FrameStatistics &stats) const { return false; }
 	virtual void setShakePos(int shakeOffset) = 0;
 	virtual void setFocusRectangle(const Common::Rect& rect) = 0;
 	virtual void clearFocusRectangle() = 0;
@@ -26,6 +26,7 @@
 #include "backends/graphics/opengl/debug.h"
 #include "backends/graphics/opengl/extensions.h"
 
+#include "common/debug.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 #include "common/algorithm.h"
@@ -52,7 +53,7 @@ OpenGLGraphicsManager::OpenGLGraphicsManager()
       _cursorX(0), _cursorY(0), _cursorDisplayX(0),_cursorDisplayY(0), _cursorHotspotX(0), _cursorHotspotY(0),
       _cursorHotspotXScaled(0), _cursorHotspotYScaled(0), _cursorWidthScaled(0), _cursorHeightScaled(0),
       _cursorKeyColor(0), _cursorVisible(false), _cursorDontScale(false), _cursorPaletteEnabled(false),
-      _forceRedraw(false), _scissorOverride(3)
+      _forceRedraw(false), _scissorOverride(3), _framePixelsUploaded(0)
 #ifdef USE_OSD
       , _osdAlpha(0), _osdFadeStartTime(0), _osd(nullptr)
 #endif
@@ -350,6 +351,21 @@ void OpenGLGraphicsManager::setShakePos(int shakeOffset) {
 	}
 }
 
+namespace {
+void addUploadStats(TextureUploadStats &total, Texture *texture) {
+	if (!texture) {
+		return;
+	}
+
+	const TextureUploadStats &stats = texture->getUploadStats();
+	total.uploads += stats.uploads;
+	total.bytesUploaded += stats.bytesUploaded;
+	total.pixelsUploaded += stats.pixelsUploaded;
+	total.pixelsConverted += stats.pixelsConverted;
+	texture->resetUploadStats();
+}
+} // End of anonymous namespace
+
 void OpenGLGraphicsManager::updateScreen() {
 	if (!_gameScreen) {
 		return;
@@ -429,6 +445,17 @@ void OpenGLGraphicsManager::updateScreen() {
 	}
 #endif
 
+	TextureUploadStats stats;
+	addUploadStats(stats, _gameScreen);
+	addUploadStats(stats, _overlay);
+	addUploadStats(stats, _cursor);
+#ifdef USE_OSD
+	addUploadStats(stats, _osd);
+#endif
+	debug(9, "OpenGL: Frame uploaded %u bytes in %u uploads, converted %u pixels",
+	      stats.bytesUploaded, stats.uploads, stats.pixelsConverted);
+	_framePixelsUploaded = stats.pixelsUploaded;
+
 	refreshScreen();
 }
 
@@ -483,6 +483,13 @@ private:
 	 */
 	uint _scissorOverride;
 
+protected:
+	/**
+	 * Number of texture pixels uploaded for the frame passed to
+	 * refreshScreen().
+	 */
+	uint _framePixelsUploaded;
+
 #ifdef USE_OSD
 	//
 	// OSD
@@ -41,6 +41,53 @@ static GLuint nextHigher2(GLuint v) {
 	return ++v;
 }
 
+namespace {
+class GLTextureUploader : public TextureUploader {
+public:
+	virtual GLuint createTexture(GLint filter) {
+		GLuint texture = 0;
+		GLCALL(glGenTextures(1, &texture));
+
+		// Set up all texture parameters.
+		GLCALL(glBindTexture(GL_TEXTURE_2D, texture));
+		GLCALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+		GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter));
+		GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter));
+		GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+		GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+		return texture;
+	}
+
+	virtual void deleteTexture(GLuint texture) {
+		GLCALL(glDeleteTextures(1, &texture));
+	}
+
+	virtual void setFilter(GLuint texture, GLint filter) {
+		GLCALL(glBindTexture(GL_TEXTURE_2D, texture));
+		GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter));
+		GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter));
+	}
+
+	virtual void allocateStorage(GLuint texture, GLenum glIntFormat, uint width, uint height,
+	                             GLenum glFormat, GLenum glType) {
+		GLCALL(glBindTexture(GL_TEXTURE_2D, texture));
+		GLCALL(glTexImage2D(GL_TEXTURE_2D, 0, glIntFormat, width, height, 0, glFormat, glType, NULL));
+	}
+
+	virtual void uploadArea(GLuint texture, const Common::Rect &area,
+	                        GLenum glFormat, GLenum glType, const void *pixels) {
+		GLCALL(glBindTexture(GL_TEXTURE_2D, texture));
+		GLCALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                       glFormat, glType, pixels));
+	}
+};
+} // End of anonymous namespace
+
+TextureUploader *TextureUploader::getDefault() {
+	static GLTextureUploader uploader;
+	return &uploader;
+}
+
 GLint Texture::_maxTextureSize = 0;
 
 void Texture::queryTextureInformation() {
@@ -48,8 +95,9 @@ void Texture::queryTextureInformation() {
 	debug(5, "OpenGL maximum texture size: %d", _maxTextureSize);
 }
 
-Texture::Texture(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format)
-    : _glIntFormat(glIntFormat), _glFormat(glFormat), _glType(glType), _format(format), _glFilter(GL_NEAREST),
+Texture::Texture(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format,
+                 TextureUploader *uploader)
+    : _uploader(uploader ? uploader : TextureUploader::getDefault()), _glIntFormat(glIntFormat), _glFormat(glFormat), _glType(glType), _format(format), _glFilter(GL_NEAREST),
       _glTexture(0), _textureData(), _userPixelData(), _allDirty(false) {
 	recreateInternalTexture();
 }
@@ -60,7 +108,7 @@ Texture::~Texture() {
 }
 
 void Texture::releaseInternalTexture() {
-	GLCALL(glDeleteTextures(1, &_glTexture));
+	_uploader->deleteTexture(_glTexture);
 	_glTexture = 0;
 }
 
@@ -69,21 +117,13 @@ void Texture::recreateInternalTexture() {
 	releaseInternalTexture();
 
 	// Get a new texture name.
-	GLCALL(glGenTextures(1, &_glTexture));
-
-	// Set up all texture parameters.
-	GLCALL(glBindTexture(GL_TEXTURE_2D, _glTexture));
-	GLCALL(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
-	GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, _glFilter));
-	GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, _glFilter));
-	GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
-	GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+	_glTexture = _uploader->createTexture(_glFilter);
 
 	// In case there is an actual texture setup we reinitialize it.
 	if (_textureData.getPixels()) {
 		// Allocate storage for OpenGL texture.
-		GLCALL(glTexImage2D(GL_TEXTURE_2D, 0, _glIntFormat, _textureData.w,
-		       _textureData.h, 0, _glFormat, _glType, NULL));
+		_uploader->allocateStorage(_glTexture, _glIntFormat, _textureData.w, _textureData.h,
+		                           _glFormat, _glType);
 
 		// Mark dirts such that it will be completely refreshed the next time.
 		flagDirty();
@@ -97,10 +137,7 @@ void Texture::enableLinearFiltering(bool enable) {
 		_glFilter = GL_NEAREST;
 	}
 
-	GLCALL(glBindTexture(GL_TEXTURE_2D, _glTexture));
-
-	GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, _glFilter));
-	GLCALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, _glFilter));
+	_uploader->setFilter(_glTexture, _glFilter);
 }
 
 void Texture::allocate(uint width, uint height) {
@@ -116,12 +153,9 @@ void Texture::allocate(uint width, uint height) {
 		// Create a buffer for the texture data.
 		_textureData.create(texWidth, texHeight, _format);
 
-		// Set the texture.
-		GLCALL(glBindTexture(GL_TEXTURE_2D, _glTexture));
-
 		// Allocate storage for OpenGL texture.
-		GLCALL(glTexImage2D(GL_TEXTURE_2D, 0, _glIntFormat, _textureData.w,
-		       _textureData.h, 0, _glFormat, _glType, NULL));
+		_uploader->allocateStorage(_glTexture, _glIntFormat, _textureData.w, _textureData.h,
+		                           _glFormat, _glType);
 	}
 
 	// Create a sub-buffer for raw access.
@@ -133,15 +167,7 @@ void Texture::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcP
 	assert(x + w <= dstSurf->w);
 	assert(y + h <= dstSurf->h);
 
-	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
-	// parameters is an empty rect. Thus, we check whether the current dirty
-	// area is valid. In case it is not we simply use the parameters as new
-	// dirty area. Otherwise, we simply call extend.
-	if (_dirtyArea.isEmpty()) {
-		_dirtyArea = Common::Rect(x, y, x + w, y + h);
-	} else {
-		_dirtyArea.extend(Common::Rect(x, y, x + w, y + h));
-	}
+	addDirtyRect(Common::Rect(x, y, x + w, y + h));
 
 	const byte *src = (const byte *)srcPtr;
 	byte *dst = (byte *)dstSurf->getBasePtr(x, y);
@@ -207,75 +233,130 @@ void Texture::updateTexture() {
 		return;
 	}
 
-	Common::Rect dirtyArea = getDirtyArea();
+	const Common::Array<Common::Rect> &dirtyRects = getDirtyRects();
+	for (uint i = 0; i < dirtyRects.size(); ++i) {
+		uploadArea(dirtyRects[i]);
+	}
+
+	// We should have handled everything, thus not dirty anymore.
+	clearDirty();
+}
+
+const Common::Array<Common::Rect> &Texture::getDirtyRects() {
+	if (_allDirty) {
+		_dirtyRects.clear();
+		_dirtyRects.push_back(Common::Rect(_userPixelData.w, _userPixelData.h));
+	}
+
+	return _dirtyRects;
+}
+
+namespace {
+// More dirty rects than this are merged into their bounding box. Every rect
+// means an additional upload, which is not worth it for many small rects.
+enum {
+	kMaxDirtyRects = 8
+};
+} // End of anonymous namespace
+
+void Texture::addDirtyRect(const Common::Rect &rect) {
+	if (_allDirty || rect.isEmpty()) {
+		return;
+	}
+
+	// Merge the new rect with all rects it overlaps or touches, the merged
+	// rect might then overlap other ones.
+	Common::Rect area = rect;
+	for (uint i = 0; i < _dirtyRects.size();) {
+		const Common::Rect &r = _dirtyRects[i];
+		if (area.left <= r.right && r.left <= area.right && area.top <= r.bottom && r.top <= area.bottom) {
+			area.extend(r);
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
+	}
+
+	if (_dirtyRects.size() >= kMaxDirtyRects) {
+		for (uint i = 0; i < _dirtyRects.size(); ++i) {
+			area.extend(_dirtyRects[i]);
+		}
+		_dirtyRects.clear();
+	}
+
+	_dirtyRects.push_back(area);
+}
+
+void Texture::uploadArea(Common::Rect area) {
+	const uint bytesPerPixel = _textureData.format.bytesPerPixel;
 
 	// In case we use linear filtering we might need to duplicate the last
 	// pixel row/column to avoid glitches with filtering.
 	if (_glFilter == GL_LINEAR) {
-		if (dirtyArea.right == _userPixelData.w && _userPixelData.w != _textureData.w) {
-			uint height = dirtyArea.height();
+		if (area.right == _userPixelData.w && _userPixelData.w != _textureData.w) {
+			uint height = area.height();
 
-			const byte *src = (const byte *)_textureData.getBasePtr(_userPixelData.w - 1, dirtyArea.top);
-			byte *dst = (byte *)_textureData.getBasePtr(_userPixelData.w, dirtyArea.top);
+			const byte *src = (const byte *)_textureData.getBasePtr(_userPixelData.w - 1, area.top);
+			byte *dst = (byte *)_textureData.getBasePtr(_userPixelData.w, area.top);
 
 			while (height-- > 0) {
-				memcpy(dst, src, _textureData.format.bytesPerPixel);
+				memcpy(dst, src, bytesPerPixel);
 				dst += _textureData.pitch;
 				src += _textureData.pitch;
 			}
 
 			// Extend the dirty area.
-			++dirtyArea.right;
+			++area.right;
 		}
 
-		if (dirtyArea.bottom == _userPixelData.h && _userPixelData.h != _textureData.h) {
-			const byte *src = (const byte *)_textureData.getBasePtr(dirtyArea.left, _userPixelData.h - 1);
-			byte *dst = (byte *)_textureData.getBasePtr(dirtyArea.left, _userPixelData.h);
-			memcpy(dst, src, dirtyArea.width() * _textureData.format.bytesPerPixel);
+		if (area.bottom == _userPixelData.h && _userPixelData.h != _textureData.h) {
+			const byte *src = (const byte *)_textureData.getBasePtr(area.left, _userPixelData.h - 1);
+			byte *dst = (byte *)_textureData.getBasePtr(area.left, _userPixelData.h);
+			memcpy(dst, src, area.width() * bytesPerPixel);
 
 			// Extend the dirty area.
-			++dirtyArea.bottom;
+			++area.bottom;
 		}
 	}
 
-	// Set the texture.
-	GLCALL(glBindTexture(GL_TEXTURE_2D, _glTexture));
+	// glTexSubImage2D expects tightly packed rows, and OpenGL ES 1.0 does not
+	// support GL_UNPACK_ROW_LENGTH to specify a pitch. Areas covering most of
+	// the texture width are uploaded as whole texture lines straight from
+	// the texture buffer, the extra pixels are cheaper than copying. Narrower
+	// areas are packed into the staging buffer first, so that we only upload
+	// the pixels which actually changed.
+	const void *pixels;
+	if (area.width() * 2 >= _textureData.w) {
+		area.left = 0;
+		area.right = _textureData.w;
+		pixels = _textureData.getBasePtr(0, area.top);
+	} else {
+		const uint rowSize = area.width() * bytesPerPixel;
+		if (_stagingBuffer.size() < rowSize * area.height()) {
+			_stagingBuffer.resize(rowSize * area.height());
+		}
 
-	// Update the actual texture.
-	// Although we keep track of the dirty part of the texture buffer we
-	// cannot take advantage of the left/right boundries here because it is
-	// not possible to specify a pitch to glTexSubImage2D. To be precise, with
-	// plain OpenGL we could set GL_UNPACK_ROW_LENGTH to achieve this. However,
-	// OpenGL ES 1.0 does not support GL_UNPACK_ROW_LENGTH. Thus, we are left
-	// with the following options:
-	//
-	// 1) (As we do right now) Simply always update the whole texture lines of
-	//    rect changed. This is simplest to implement. In case performance is
-	//    really an issue we can think of switching to another method.
-	//
-	// 2) Copy the dirty rect to a temporary buffer and upload that by using
-	//    glTexSubImage2D. This is what the Android backend does. It is more
-	//    complicated though.
-	//
-	// 3) Use glTexSubImage2D per line changed. This is what the old OpenGL
-	//    graphics manager did but it is much slower! Thus, we do not use it.
-	GLCALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, dirtyArea.top, _textureData.w, dirtyArea.height(),
-	                       _glFormat, _glType, _textureData.getBasePtr(0, dirtyArea.top)));
+		const byte *src = (const byte *)_textureData.getBasePtr(area.left, area.top);
+		byte *dst = _stagingBuffer.begin();
+		for (int y = area.top; y < area.bottom; ++y) {
+			memcpy(dst, src, rowSize);
+			dst += rowSize;
+			src += _textureData.pitch;
+		}
+		pixels = _stagingBuffer.begin();
+	}
 
-	// We should have handled everything, thus not dirty anymore.
-	clearDirty();
-}
+	_uploader->uploadArea(_glTexture, area, _glFormat, _glType, pixels);
 
-Common::Rect Texture::getDirtyArea() const {
-	if (_allDirty) {
-		return Common::Rect(_userPixelData.w, _userPixelData.h);
-	} else {
-		return _dirtyArea;
-	}
+	++_uploadStats.uploads;
+	_uploadStats.pixelsUploaded += area.width() * area.height();
+	_uploadStats.bytesUploaded += area.width() * area.height() * bytesPerPixel;
 }
 
-TextureCLUT8::TextureCLUT8(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format)
-    : Texture(glIntFormat, glFormat, glType, format), _clut8Data(), _palette(new byte[256 * format.bytesPerPixel]) {
+TextureCLUT8::TextureCLUT8(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format,
+                           TextureUploader *uploader)
+    : Texture(glIntFormat, glFormat, glType, format, uploader), _clut8Data(), _palette(new byte[256 * format.bytesPerPixel]) {
 	memset(_palette, 0, sizeof(byte) * format.bytesPerPixel);
 }
 
@@ -348,23 +429,29 @@ void TextureCLUT8::updateTexture() {
 		return;
 	}
 
-	// Do the palette look up
+	// Do the palette look up for the changed areas only
 	Graphics::Surface *outSurf = Texture::getSurface();
 
-	Common::Rect dirtyArea = getDirtyArea();
-
-	if (outSurf->format.bytesPerPixel == 2) {
-		doPaletteLookUp<uint16>((uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        dirtyArea.width(), dirtyArea.height(),
-		                        outSurf->pitch, _clut8Data.pitch, (const uint16 *)_palette);
-	} else if (outSurf->format.bytesPerPixel == 4) {
-		doPaletteLookUp<uint32>((uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
-		                        dirtyArea.width(), dirtyArea.height(),
-		                        outSurf->pitch, _clut8Data.pitch, (const uint32 *)_palette);
-	} else {
-		warning("TextureCLUT8::updateTexture: Unsupported pixel depth: %d", outSurf->format.bytesPerPixel);
+	const Common::Array<Common::Rect> &dirtyRects = getDirtyRects();
+	for (uint i = 0; i < dirtyRects.size(); ++i) {
+		const Common::Rect &dirtyArea = dirtyRects[i];
+
+		if (outSurf->format.bytesPerPixel == 2) {
+			doPaletteLookUp<uint16>((uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        dirtyArea.width(), dirtyArea.height(),
+			                        outSurf->pitch, _clut8Data.pitch, (const uint16 *)_palette);
+		} else if (outSurf->format.bytesPerPixel == 4) {
+			doPaletteLookUp<uint32>((uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        (const byte *)_clut8Data.getBasePtr(dirtyArea.left, dirtyArea.top),
+			                        dirtyArea.width(), dirtyArea.height(),
+			                        outSurf->pitch, _clut8Data.pitch, (const uint32 *)_palette);
+		} else {
+			warning("TextureCLUT8::updateTexture: Unsupported pixel depth: %d", outSurf->format.bytesPerPixel);
+			break;
+		}
+
+		_uploadStats.pixelsConverted += dirtyArea.width() * dirtyArea.height();
 	}
 
 	// Do generic handling of updating the texture.
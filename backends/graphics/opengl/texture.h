@@ -28,10 +28,62 @@
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 
 namespace OpenGL {
 
+/**
+ * The OpenGL calls used to create and update textures. The default
+ * implementation forwards them to OpenGL, other implementations allow to
+ * exercise Texture without an OpenGL context.
+ */
+class TextureUploader {
+public:
+	virtual ~TextureUploader() {}
+
+	/**
+	 * Create a texture name and set up its parameters.
+	 */
+	virtual GLuint createTexture(GLint filter) = 0;
+
+	virtual void deleteTexture(GLuint texture) = 0;
+
+	virtual void setFilter(GLuint texture, GLint filter) = 0;
+
+	/**
+	 * Allocate the storage of a texture, leaving its contents undefined.
+	 */
+	virtual void allocateStorage(GLuint texture, GLenum glIntFormat, uint width, uint height,
+	                             GLenum glFormat, GLenum glType) = 0;
+
+	/**
+	 * Upload an area of a texture. The pixel data of the area is tightly
+	 * packed, i.e. rows are area.width() pixels apart.
+	 */
+	virtual void uploadArea(GLuint texture, const Common::Rect &area,
+	                        GLenum glFormat, GLenum glType, const void *pixels) = 0;
+
+	/**
+	 * @return The uploader making the actual OpenGL calls.
+	 */
+	static TextureUploader *getDefault();
+};
+
+/**
+ * Work done to bring a texture up to date since the last reset.
+ */
+struct TextureUploadStats {
+	uint uploads;
+	uint bytesUploaded;
+	uint pixelsUploaded;
+	uint pixelsConverted;
+
+	TextureUploadStats() { reset(); }
+
+	void reset() { uploads = bytesUploaded = pixelsUploaded = pixelsConverted = 0; }
+};
+
 /**
  * An OpenGL texture wrapper. It automatically takes care of all OpenGL
  * texture handling issues and also provides access to the texture data.
@@ -45,8 +97,10 @@ public:
 	 * @param glFormat    The input format.
 	 * @param glType      The input type.
 	 * @param format      The format used for the texture input.
+	 * @param uploader    The OpenGL calls to use, the default uploader if 0.
 	 */
-	Texture(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format);
+	Texture(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format,
+	        TextureUploader *uploader = 0);
 	virtual ~Texture();
 
 	/**
@@ -82,7 +136,16 @@ public:
 	void draw(GLfloat x, GLfloat y, GLfloat w, GLfloat h);
 
 	void flagDirty() { _allDirty = true; }
-	bool isDirty() const { return _allDirty || !_dirtyArea.isEmpty(); }
+	bool isDirty() const { return _allDirty || !_dirtyRects.empty(); }
+
+	/**
+	 * Upload all pending changes to the OpenGL texture. This is done
+	 * automatically when drawing the texture.
+	 */
+	virtual void updateTexture();
+
+	const TextureUploadStats &getUploadStats() const { return _uploadStats; }
+	void resetUploadStats() { _uploadStats.reset(); }
 
 	uint getWidth() const { return _userPixelData.w; }
 	uint getHeight() const { return _userPixelData.h; }
@@ -121,10 +184,18 @@ public:
 	 */
 	static GLint getMaximumTextureSize() { return _maxTextureSize; }
 protected:
-	virtual void updateTexture();
+	/**
+	 * @return The areas changed since the last update.
+	 */
+	const Common::Array<Common::Rect> &getDirtyRects();
 
-	Common::Rect getDirtyArea() const;
+	TextureUploadStats _uploadStats;
 private:
+	void addDirtyRect(const Common::Rect &rect);
+	void uploadArea(Common::Rect area);
+
+	TextureUploader *_uploader;
+
 	const GLenum _glIntFormat;
 	const GLenum _glFormat;
 	const GLenum _glType;
@@ -136,16 +207,24 @@ private:
 	Graphics::Surface _textureData;
 	Graphics::Surface _userPixelData;
 
+	// Areas changed since the last update, unless the whole texture is
+	// dirty anyway. Overlapping areas are merged, and too many areas are
+	// merged into their bounding box.
 	bool _allDirty;
-	Common::Rect _dirtyArea;
-	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); }
+	Common::Array<Common::Rect> _dirtyRects;
+	void clearDirty() { _allDirty = false; _dirtyRects.clear(); }
+
+	// Packed copy of dirty areas narrower than the texture, kept around
+	// between updates
+	Common::Array<byte> _stagingBuffer;
 
 	static GLint _maxTextureSize;
 };
 
 class TextureCLUT8 : public Texture {
 public:
-	TextureCLUT8(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format);
+	TextureCLUT8(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format,
+	             TextureUploader *uploader = 0);
 	virtual ~TextureCLUT8();
 
 	virtual void allocate(uint width, uint height);
@@ -162,7 +241,6 @@ public:
 	virtual Graphics::Surface *getSurface() { return &_clut8Data; }
 	virtual const Graphics::Surface *getSurface() const { return &_clut8Data; }
 
-protected:
 	virtual void updateTexture();
 
 private:
@@ -37,7 +37,7 @@ OpenGLSdlGraphicsManager::OpenGLSdlGraphicsManager(uint desktopWidth, uint deskt
       _lastVideoModeLoad(0), _hwScreen(nullptr),
 #endif
       _graphicsScale(2), _ignoreLoadVideoMode(false), _gotResize(false), _wantsFullScreen(false), _ignoreResizeEvents(0),
-      _desiredFullscreenWidth(0), _desiredFullscreenHeight(0) {
+      _updateStartTime(0), _desiredFullscreenWidth(0), _desiredFullscreenHeight(0) {
 	// Setup OpenGL attributes for SDL
 	SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
 	SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
@@ -236,6 +236,7 @@ void OpenGLSdlGraphicsManager::updateScreen() {
 		--_ignoreResizeEvents;
 	}
 
+	_updateStartTime = getMicroseconds();
 	OpenGLGraphicsManager::updateScreen();
 }
 
@@ -297,12 +298,20 @@ bool OpenGLSdlGraphicsManager::loadVideoMode(uint requestedWidth, uint requested
 }
 
 void OpenGLSdlGraphicsManager::refreshScreen() {
+	// The scaling is done by OpenGL, all CPU work is done at this point
+	_frameStats.updateTime = getMicroseconds() - _updateStartTime;
+	_frameStats.scalerTime = 0;
+	_frameStats.dirtyPixels = _framePixelsUploaded;
+
 	// Swap OpenGL buffers
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 	SDL_GL_SwapWindow(_window->getSDLWindow());
 #else
 	SDL_GL_SwapBuffers();
 #endif
+
+	_frameStats.frameCount++;
+	_frameStats.presentTime = g_system->getMillis();
 }
 
 bool OpenGLSdlGraphicsManager::setupMode(uint width, uint height) {
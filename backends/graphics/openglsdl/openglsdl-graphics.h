@@ -88,6 +88,9 @@ private:
 	bool _wantsFullScreen;
 	uint _ignoreResizeEvents;
 
+	// When the current screen update started, for the frame statistics
+	uint32 _updateStartTime;
+
 	struct VideoMode {
 		VideoMode() : width(0), height(0) {}
 		VideoMode(uint w, uint h) : width(w), height(h) {}
@@ -28,6 +28,7 @@
 
 SdlGraphicsManager::SdlGraphicsManager(SdlEventSource *source, SdlWindow *window)
 	: _eventSource(source), _window(window) {
+	memset(&_frameStats, 0, sizeof(_frameStats));
 }
 
 SdlGraphicsManager::~SdlGraphicsManager() {
@@ -41,6 +42,22 @@ void SdlGraphicsManager::deactivateManager() {
 	_eventSource->setGraphicsManager(0);
 }
 
+bool SdlGraphicsManager::getFrameStatistics(OSystem::FrameStatistics &stats) const {
+	stats = _frameStats;
+	return true;
+}
+
+uint32 SdlGraphicsManager::getMicroseconds() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	const Uint64 counter = SDL_GetPerformanceCounter();
+	const Uint64 frequency = SDL_GetPerformanceFrequency();
+	// Split the conversion to avoid overflows with high resolution counters
+	return (uint32)((counter / frequency) * 1000000 + (counter % frequency) * 1000000 / frequency);
+#else
+	return SDL_GetTicks() * 1000;
+#endif
+}
+
 SdlGraphicsManager::State SdlGraphicsManager::getState() {
 	State state;
 
@@ -122,9 +122,22 @@ public:
 	 */
 	SdlWindow *getWindow() const { return _window; }
 
+	virtual bool getFrameStatistics(OSystem::FrameStatistics &stats) const;
+
 protected:
 	SdlEventSource *_eventSource;
 	SdlWindow *_window;
+
+	/**
+	 * @return A timestamp in microseconds, for timing screen updates.
+	 */
+	static uint32 getMicroseconds();
+
+	/**
+	 * Statistics of the last presented frame, to be filled in by the
+	 * implementations.
+	 */
+	OSystem::FrameStatistics _frameStats;
 };
 
 #endif
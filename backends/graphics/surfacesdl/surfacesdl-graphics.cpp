@@ -142,6 +142,7 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 	_mouseOrigSurface(0), _cursorDontScale(false), _cursorPaletteDisabled(true),
 	_currentShakePos(0), _newShakePos(0),
 	_paletteDirtyStart(0), _paletteDirtyEnd(0),
+	_paletteStatsTime(0), _paletteUpdates(0), _paletteDirtyRects(0), _paletteFullRedraws(0),
 	_screenIsLocked(false),
 	_graphicsMutex(0),
 	_displayDisabled(false),
@@ -153,6 +154,8 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 	// allocate palette storage
 	_currentPalette = (SDL_Color *)calloc(sizeof(SDL_Color), 256);
 	_cursorPalette = (SDL_Color *)calloc(sizeof(SDL_Color), 256);
+	memset(_paletteEntryChanged, 0, sizeof(_paletteEntryChanged));
+	memset(_paletteLookup, 0, sizeof(_paletteLookup));
 
 	_mouseBackup.x = _mouseBackup.y = _mouseBackup.w = _mouseBackup.h = 0;
 
@@ -845,6 +848,8 @@ bool SurfaceSdlGraphicsManager::loadGFXMode() {
 	if (_tmpscreen == NULL)
 		error("allocating _tmpscreen failed");
 
+	updatePaletteLookup(0, 256);
+
 	_overlayscreen = SDL_CreateRGBSurface(SDL_SWSURFACE, _videoMode.overlayWidth, _videoMode.overlayHeight,
 						16,
 						_hwscreen->format->Rmask,
@@ -1020,6 +1025,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 	int height, width;
 	ScalerProc *scalerProc;
 	int scale1;
+	const uint32 updateStart = getMicroseconds();
 
 	// definitions not available for non-DEBUG here. (needed this to compile in SYMBIAN32 & linux?)
 #if defined(DEBUG) && !defined(WIN32) && !defined(_WIN32_WCE)
@@ -1048,10 +1054,25 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		SDL_SetColors(_screen, _currentPalette + _paletteDirtyStart,
 			_paletteDirtyStart,
 			_paletteDirtyEnd - _paletteDirtyStart);
+		updatePaletteLookup(_paletteDirtyStart, _paletteDirtyEnd);
+
+		// The overlay doesn't use the palette, and hiding it redraws
+		// the whole screen anyway
+		if (!_overlayVisible)
+			addPaletteDirtyRects();
 
+		memset(_paletteEntryChanged + _paletteDirtyStart, 0, _paletteDirtyEnd - _paletteDirtyStart);
+		_paletteDirtyStart = 256;
 		_paletteDirtyEnd = 0;
+		_paletteUpdates++;
+	}
 
-		_forceFull = true;
+	const uint32 now = SDL_GetTicks();
+	if (now - _paletteStatsTime >= 1000) {
+		if (_paletteUpdates)
+			debug(2, "Palette updates: %u/s, dirty rects: %u, full redraws: %u", _paletteUpdates, _paletteDirtyRects, _paletteFullRedraws);
+		_paletteUpdates = _paletteDirtyRects = _paletteFullRedraws = 0;
+		_paletteStatsTime = now;
 	}
 
 #ifdef USE_OSD
@@ -1111,19 +1132,43 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		SDL_Rect dst;
 		uint32 srcPitch, dstPitch;
 		SDL_Rect *lastRect = _dirtyRectList + _numDirtyRects;
+		uint32 dirtyPixels = 0;
+
+		// Expand 8 bit game screens through the palette lookup table,
+		// which is a lot faster than a generic SDL blit
+		bool clut8 = (origSurf == _screen);
+#ifdef USE_RGB_COLOR
+		clut8 = clut8 && _screenFormat.bytesPerPixel == 1;
+#endif
+
+		if (clut8) {
+			SDL_LockSurface(_screen);
+			SDL_LockSurface(_tmpscreen);
+		}
 
 		for (r = _dirtyRectList; r != lastRect; ++r) {
 			dst = *r;
 			dst.x++;	// Shift rect by one since 2xSai needs to access the data around
 			dst.y++;	// any pixel to scale it, and we want to avoid mem access crashes.
 
-			if (SDL_BlitSurface(origSurf, r, srcSurf, &dst) != 0)
+			dirtyPixels += r->w * r->h;
+
+			if (clut8)
+				blitCLUT8ToTmpScreen(*r, dst.x, dst.y);
+			else if (SDL_BlitSurface(origSurf, r, srcSurf, &dst) != 0)
 				error("SDL_BlitSurface failed: %s", SDL_GetError());
 		}
 
+		if (clut8) {
+			SDL_UnlockSurface(_tmpscreen);
+			SDL_UnlockSurface(_screen);
+		}
+
 		SDL_LockSurface(srcSurf);
 		SDL_LockSurface(_hwscreen);
 
+		const uint32 scalerStart = getMicroseconds();
+
 		srcPitch = srcSurf->pitch;
 		dstPitch = _hwscreen->pitch;
 
@@ -1163,6 +1208,9 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 				r->h = stretch200To240((uint8 *) _hwscreen->pixels, dstPitch, r->w, r->h, r->x, r->y, orig_dst_y * scale1);
 #endif
 		}
+
+		const uint32 scalerTime = getMicroseconds() - scalerStart;
+
 		SDL_UnlockSurface(srcSurf);
 		SDL_UnlockSurface(_hwscreen);
 
@@ -1257,6 +1305,12 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 		if (!_displayDisabled) {
 			SDL_UpdateRects(_hwscreen, _numDirtyRects, _dirtyRectList);
 		}
+
+		_frameStats.frameCount++;
+		_frameStats.presentTime = g_system->getMillis();
+		_frameStats.updateTime = getMicroseconds() - updateStart;
+		_frameStats.scalerTime = scalerTime;
+		_frameStats.dirtyPixels = dirtyPixels;
 	}
 
 	_numDirtyRects = 0;
@@ -1396,6 +1450,103 @@ void SurfaceSdlGraphicsManager::fillScreen(uint32 col) {
 	unlockScreen();
 }
 
+void SurfaceSdlGraphicsManager::updatePaletteLookup(uint start, uint end) {
+	if (!_tmpscreen)
+		return;
+
+	for (uint i = start; i < end; ++i)
+		_paletteLookup[i] = SDL_MapRGB(_tmpscreen->format, _currentPalette[i].r, _currentPalette[i].g, _currentPalette[i].b);
+}
+
+void SurfaceSdlGraphicsManager::blitCLUT8ToTmpScreen(const SDL_Rect &src, int dstX, int dstY) {
+	const byte *srcRow = (const byte *)_screen->pixels + src.y * _screen->pitch + src.x;
+	byte *dstRow = (byte *)_tmpscreen->pixels + dstY * _tmpscreen->pitch + dstX * 2;
+
+	for (int y = 0; y < src.h; ++y) {
+		uint16 *dstPixel = (uint16 *)dstRow;
+		int x = 0;
+
+		for (; x + 4 <= src.w; x += 4) {
+			dstPixel[x + 0] = _paletteLookup[srcRow[x + 0]];
+			dstPixel[x + 1] = _paletteLookup[srcRow[x + 1]];
+			dstPixel[x + 2] = _paletteLookup[srcRow[x + 2]];
+			dstPixel[x + 3] = _paletteLookup[srcRow[x + 3]];
+		}
+		for (; x < src.w; ++x)
+			dstPixel[x] = _paletteLookup[srcRow[x]];
+
+		srcRow += _screen->pitch;
+		dstRow += _tmpscreen->pitch;
+	}
+}
+
+void SurfaceSdlGraphicsManager::addPaletteDirtyRects() {
+	if (_forceFull)
+		return;
+
+#ifdef USE_RGB_COLOR
+	if (_screenFormat.bytesPerPixel != 1)
+		return;
+#endif
+
+	// Fades change most of the palette, there's no point in looking for
+	// the pixels using it then
+	uint changed = 0;
+	for (uint i = _paletteDirtyStart; i < _paletteDirtyEnd; ++i)
+		changed += _paletteEntryChanged[i];
+
+	if (changed > 128) {
+		_forceFull = true;
+		_paletteFullRedraws++;
+		return;
+	}
+
+	// Collect runs of rows that contain changed colors into dirty rects
+	const int width = _videoMode.screenWidth;
+	const int height = _videoMode.screenHeight;
+	int top = -1, left = width, right = -1;
+
+	SDL_LockSurface(_screen);
+
+	for (int y = 0; y <= height; ++y) {
+		int x1 = -1, x2 = -1;
+
+		if (y < height) {
+			const byte *row = (const byte *)_screen->pixels + y * _screen->pitch;
+
+			for (int x = 0; x < width; ++x) {
+				if (_paletteEntryChanged[row[x]]) {
+					x1 = x;
+					break;
+				}
+			}
+
+			if (x1 >= 0) {
+				for (x2 = width - 1; !_paletteEntryChanged[row[x2]]; --x2)
+					;
+			}
+		}
+
+		if (x1 >= 0) {
+			if (top < 0)
+				top = y;
+			left = MIN(left, x1);
+			right = MAX(right, x2);
+		} else if (top >= 0) {
+			addDirtyRect(left, top, right - left + 1, y - top);
+			_paletteDirtyRects++;
+			top = -1;
+			left = width;
+			right = -1;
+		}
+	}
+
+	SDL_UnlockSurface(_screen);
+
+	if (_forceFull)
+		_paletteFullRedraws++;
+}
+
 void SurfaceSdlGraphicsManager::addDirtyRect(int x, int y, int w, int h, bool realCoordinates) {
 	if (_forceFull)
 		return;
@@ -1490,19 +1641,25 @@ void SurfaceSdlGraphicsManager::setPalette(const byte *colors, uint start, uint
 	uint i;
 	SDL_Color *base = _currentPalette + start;
 	for (i = 0; i < num; i++, b += 3) {
+		// Many games set the whole palette every frame, only entries which
+		// actually change need to be redrawn
+		if (base[i].r == b[0] && base[i].g == b[1] && base[i].b == b[2])
+			continue;
+
 		base[i].r = b[0];
 		base[i].g = b[1];
 		base[i].b = b[2];
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 		base[i].a = 255;
 #endif
-	}
+		_paletteEntryChanged[start + i] = true;
 
-	if (start < _paletteDirtyStart)
-		_paletteDirtyStart = start;
+		if (start + i < _paletteDirtyStart)
+			_paletteDirtyStart = start + i;
 
-	if (start + num > _paletteDirtyEnd)
-		_paletteDirtyEnd = start + num;
+		if (start + i + 1 > _paletteDirtyEnd)
+			_paletteDirtyEnd = start + i + 1;
+	}
 
 	// Some games blink cursors with palette
 	if (_cursorPaletteDisabled)
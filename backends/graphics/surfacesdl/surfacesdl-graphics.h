@@ -329,6 +329,16 @@ protected:
 	SDL_Color *_currentPalette;
 	uint _paletteDirtyStart, _paletteDirtyEnd;
 
+	// Palette entries which changed since the last screen update
+	bool _paletteEntryChanged[256];
+
+	// Palette entries in the format of _tmpscreen
+	uint16 _paletteLookup[256];
+
+	// Palette triggered redraws, printed once a second at debug level 2
+	uint32 _paletteStatsTime;
+	uint _paletteUpdates, _paletteDirtyRects, _paletteFullRedraws;
+
 	// Cursor palette data
 	SDL_Color *_cursorPalette;
 
@@ -346,6 +356,11 @@ protected:
 
 	virtual void addDirtyRect(int x, int y, int w, int h, bool realCoordinates = false);
 
+	/** Marks the parts of the game screen using changed palette entries as dirty */
+	void addPaletteDirtyRects();
+	void updatePaletteLookup(uint start, uint end);
+	void blitCLUT8ToTmpScreen(const SDL_Rect &src, int dstX, int dstY);
+
 	virtual void drawMouse();
 	virtual void undrawMouse();
 	virtual void blitCursor();
@@ -29,17 +29,26 @@
 #include "gui/EventRecorder.h"
 
 #include "audio/mixer.h"
+#include "common/config-manager.h"
+#include "common/file.h"
+#include "common/textconsole.h"
 #include "graphics/pixelformat.h"
 
 ModularBackend::ModularBackend()
 	:
 	_mutexManager(0),
 	_graphicsManager(0),
-	_mixer(0) {
+	_mixer(0),
+	_frameStatsChecked(false),
+	_frameStatsFile(0),
+	_frameStatsLastFrame(0),
+	_frameStatsFlushTime(0) {
 
 }
 
 ModularBackend::~ModularBackend() {
+	delete _frameStatsFile;
+	_frameStatsFile = 0;
 	delete _graphicsManager;
 	_graphicsManager = 0;
 	delete _mixer;
@@ -151,6 +160,60 @@ void ModularBackend::updateScreen() {
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.postDrawOverlayGui();
 #endif
+
+	dumpFrameStatistics();
+}
+
+bool ModularBackend::getFrameStatistics(FrameStatistics &stats) const {
+	return _graphicsManager->getFrameStatistics(stats);
+}
+
+void ModularBackend::dumpFrameStatistics() {
+	FrameStatistics stats;
+
+	if (!_frameStatsChecked) {
+		_frameStatsChecked = true;
+
+		if (!ConfMan.hasKey("frame_stats"))
+			return;
+
+		if (!_graphicsManager->getFrameStatistics(stats)) {
+			warning("Frame statistics are not supported by this backend");
+			return;
+		}
+
+		const Common::String &fileName = ConfMan.get("frame_stats");
+		Common::DumpFile *file = new Common::DumpFile();
+		if (!file->open(fileName)) {
+			warning("Could not open '%s' for writing frame statistics", fileName.c_str());
+			delete file;
+			return;
+		}
+
+		file->writeString("frame,present_ms,update_us,scaler_us,dirty_pixels\n");
+		_frameStatsFile = file;
+		_frameStatsLastFrame = stats.frameCount;
+		_frameStatsFlushTime = getMillis();
+	}
+
+	if (!_frameStatsFile)
+		return;
+
+	// Only log updates which actually presented a new frame
+	if (!_graphicsManager->getFrameStatistics(stats) || stats.frameCount == _frameStatsLastFrame)
+		return;
+	_frameStatsLastFrame = stats.frameCount;
+
+	_frameStatsFile->writeString(Common::String::format("%u,%u,%u,%u,%u\n", stats.frameCount,
+		stats.presentTime, stats.updateTime, stats.scalerTime, stats.dirtyPixels));
+
+	// Write the statistics out every second, so that they can be looked at
+	// while the game is still running
+	const uint32 now = getMillis();
+	if (now - _frameStatsFlushTime >= 1000) {
+		_frameStatsFile->flush();
+		_frameStatsFlushTime = now;
+	}
 }
 
 void ModularBackend::setShakePos(int shakeOffset) {
@@ -28,6 +28,10 @@
 class GraphicsManager;
 class MutexManager;
 
+namespace Common {
+class DumpFile;
+}
+
 /**
  * Base class for modular backends.
  *
@@ -85,6 +89,7 @@ public:
 	virtual void unlockScreen();
 	virtual void fillScreen(uint32 col);
 	virtual void updateScreen();
+	virtual bool getFrameStatistics(FrameStatistics &stats) const;
 	virtual void setShakePos(int shakeOffset);
 	virtual void setFocusRectangle(const Common::Rect& rect);
 	virtual void clearFocusRectangle();
@@ -139,6 +144,18 @@ protected:
 	Audio::Mixer *_mixer;
 
 	//@}
+
+private:
+	/**
+	 * Append the statistics of the last presented frame to the file given
+	 * by the "frame_stats" setting, as CSV.
+	 */
+	void dumpFrameStatistics();
+
+	bool _frameStatsChecked;
+	Common::DumpFile *_frameStatsFile;
+	uint32 _frameStatsLastFrame;
+	uint32 _frameStatsFlushTime;
 };
 
 #endif
@@ -99,6 +99,8 @@ static const char HELP_STRING[] =
 	"                           (separated by commas)\n"
 	"  -u, --dump-scripts       Enable script dumping if a directory called 'dumps'\n"
 	"                           exists in the current directory\n"
+	"  --frame-stats=FILE       Write timing statistics of every frame presented to\n"
+	"                           FILE, as CSV (only supported by some backends)\n"
 	"\n"
 	"  --cdrom=NUM              CD drive to play CD audio from (default: 0 = first\n"
 	"                           drive)\n"
@@ -479,6 +481,9 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 			DO_OPTION_BOOL('u', "dump-scripts")
 			END_OPTION
 
+			DO_LONG_OPTION("frame-stats")
+			END_OPTION
+
 			DO_OPTION_OPT('x', "save-slot", "0")
 			END_OPTION
 
@@ -24,6 +24,8 @@
 #include "common/debug.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/md5.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 
@@ -36,6 +38,11 @@ static bool isValidDomainName(const Common::String &domName) {
 
 namespace Common {
 
+static String computeMD5(MemoryWriteStreamDynamic &buffer) {
+	MemoryReadStream contents(buffer.getData(), buffer.size());
+	return computeStreamMD5AsString(contents);
+}
+
 DECLARE_SINGLETON(ConfigManager);
 
 char const *const ConfigManager::kApplicationDomain = "scummvm";
@@ -48,7 +55,7 @@ char const *const ConfigManager::kKeymapperDomain = "keymapper";
 #pragma mark -
 
 
-ConfigManager::ConfigManager() : _activeDomain(0) {
+ConfigManager::ConfigManager() : _generation(1), _activeDomain(0) {
 }
 
 void ConfigManager::defragment() {
@@ -68,6 +75,10 @@ void ConfigManager::copyFrom(ConfigManager &source) {
 	_keymapperDomain = source._keymapperDomain;
 #endif
 	_domainSaveOrder = source._domainSaveOrder;
+	_domainsInSaveOrder = source._domainsInSaveOrder;
+	_flushedMD5 = source._flushedMD5;
+	// Handles may still point into the source
+	_generation = source._generation + 1;
 	_activeDomainName = source._activeDomainName;
 	_activeDomain = &_gameDomains[_activeDomainName];
 	_filename = source._filename;
@@ -79,6 +90,7 @@ void ConfigManager::loadDefaultConfigFile() {
 	assert(g_system);
 	SeekableReadStream *stream = g_system->createConfigReadStream();
 	_filename.clear();  // clear the filename to indicate that we are using the default config file
+	_flushedMD5.clear();
 
 	// ... load it, if available ...
 	if (stream) {
@@ -97,6 +109,7 @@ void ConfigManager::loadDefaultConfigFile() {
 
 void ConfigManager::loadConfigFile(const String &filename) {
 	_filename = filename;
+	_flushedMD5.clear();
 
 	FSNode node(filename);
 	File cfg_file;
@@ -128,7 +141,7 @@ void ConfigManager::addDomain(const String &domainName, const ConfigManager::Dom
 
 		_gameDomains[domainName] = domain;
 
-		_domainSaveOrder.push_back(domainName);
+		addToSaveOrder(domainName);
 
 		// Check if we have the same misc domain. For older config files
 		// we could have 'ghost' domains with the same name, so delete
@@ -151,11 +164,14 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 	Domain domain;
 	int lineno = 0;
 
+	++_generation;
+
 	_appDomain.clear();
 	_gameDomains.clear();
 	_miscDomains.clear();
 	_transientDomain.clear();
 	_domainSaveOrder.clear();
+	_domainsInSaveOrder.clear();
 
 #ifdef ENABLE_KEYMAPPER
 	_keymapperDomain.clear();
@@ -240,10 +256,25 @@ void ConfigManager::loadFromStream(SeekableReadStream &stream) {
 	}
 
 	addDomain(domainName, domain); // Add the last domain found
+
+	// Flushing the configuration unchanged would just write it back
+	MemoryWriteStreamDynamic buffer(DisposeAfterUse::YES);
+	saveToStream(buffer);
+	_flushedMD5 = computeMD5(buffer);
 }
 
 void ConfigManager::flushToDisk() {
 #ifndef __DC__
+	// Put the whole file together in memory first. Settings are often
+	// flushed several times without any changes in between, in which case
+	// the file is left alone.
+	MemoryWriteStreamDynamic buffer(DisposeAfterUse::YES);
+	saveToStream(buffer);
+
+	String md5 = computeMD5(buffer);
+	if (md5 == _flushedMD5)
+		return;
+
 	WriteStream *stream;
 
 	if (_filename.empty()) {
@@ -265,19 +296,34 @@ void ConfigManager::flushToDisk() {
 		stream = dump;
 	}
 
+	// Write everything in one go
+	stream->write(buffer.getData(), buffer.size());
+	stream->finalize();
+
+	if (stream->err())
+		warning("Unable to write configuration file");
+	else
+		_flushedMD5 = md5;
+
+	delete stream;
+
+#endif // !__DC__
+}
+
+void ConfigManager::saveToStream(WriteStream &stream) const {
 	// Write the application domain
-	writeDomain(*stream, kApplicationDomain, _appDomain);
+	writeDomain(stream, kApplicationDomain, _appDomain);
 
 #ifdef ENABLE_KEYMAPPER
 	// Write the keymapper domain
-	writeDomain(*stream, kKeymapperDomain, _keymapperDomain);
+	writeDomain(stream, kKeymapperDomain, _keymapperDomain);
 #endif
 
 	DomainMap::const_iterator d;
 
 	// Write the miscellaneous domains next
 	for (d = _miscDomains.begin(); d != _miscDomains.end(); ++d) {
-		writeDomain(*stream, d->_key, d->_value);
+		writeDomain(stream, d->_key, d->_value);
 	}
 
 	// First write the domains in _domainSaveOrder, in that order.
@@ -285,23 +331,26 @@ void ConfigManager::flushToDisk() {
 	// are not present anymore, so we validate each name.
 	Array<String>::const_iterator i;
 	for (i = _domainSaveOrder.begin(); i != _domainSaveOrder.end(); ++i) {
-		if (_gameDomains.contains(*i)) {
-			writeDomain(*stream, *i, _gameDomains[*i]);
+		d = _gameDomains.find(*i);
+		if (d != _gameDomains.end()) {
+			writeDomain(stream, *i, d->_value);
 		}
 	}
 
 	// Now write the domains which haven't been written yet
 	for (d = _gameDomains.begin(); d != _gameDomains.end(); ++d) {
-		if (find(_domainSaveOrder.begin(), _domainSaveOrder.end(), d->_key) == _domainSaveOrder.end())
-			writeDomain(*stream, d->_key, d->_value);
+		if (!_domainsInSaveOrder.contains(d->_key))
+			writeDomain(stream, d->_key, d->_value);
 	}
+}
 
-	delete stream;
-
-#endif // !__DC__
+bool ConfigManager::isFlushed() const {
+	MemoryWriteStreamDynamic buffer(DisposeAfterUse::YES);
+	saveToStream(buffer);
+	return computeMD5(buffer) == _flushedMD5;
 }
 
-void ConfigManager::writeDomain(WriteStream &stream, const String &name, const Domain &domain) {
+void ConfigManager::writeDomain(WriteStream &stream, const String &name, const Domain &domain) const {
 	if (domain.empty())
 		return;     // Don't bother writing empty domains.
 
@@ -371,6 +420,9 @@ ConfigManager::Domain *ConfigManager::getDomain(const String &domName) {
 	assert(!domName.empty());
 	assert(isValidDomainName(domName));
 
+	// The caller may change the domain
+	++_generation;
+
 	if (domName == kTransientDomain)
 		return &_transientDomain;
 	if (domName == kApplicationDomain)
@@ -432,6 +484,7 @@ void ConfigManager::removeKey(const String &key, const String &domName) {
 		      key.c_str(), domName.c_str());
 
 	domain->erase(key);
+	++_generation;
 }
 
 
@@ -439,12 +492,21 @@ void ConfigManager::removeKey(const String &key, const String &domName) {
 
 
 const String &ConfigManager::get(const String &key) const {
-	if (_transientDomain.contains(key))
-		return _transientDomain[key];
-	else if (_activeDomain && _activeDomain->contains(key))
-		return (*_activeDomain)[key];
-	else if (_appDomain.contains(key))
-		return _appDomain[key];
+	// Engines query some settings very often, so only look the key up
+	// once in each domain
+	Domain::const_iterator it = _transientDomain.find(key);
+	if (it != _transientDomain.end())
+		return it->_value;
+
+	if (_activeDomain) {
+		it = _activeDomain->find(key);
+		if (it != _activeDomain->end())
+			return it->_value;
+	}
+
+	it = _appDomain.find(key);
+	if (it != _appDomain.end())
+		return it->_value;
 
 	return _defaultsDomain.getVal(key);
 }
@@ -462,14 +524,14 @@ const String &ConfigManager::get(const String &key, const String &domName) const
 		error("ConfigManager::get(%s,%s) called on non-existent domain",
 		      key.c_str(), domName.c_str());
 
-	if (domain->contains(key))
-		return (*domain)[key];
+	Domain::const_iterator it = domain->find(key);
+	if (it != domain->end())
+		return it->_value;
 
 	return _defaultsDomain.getVal(key);
 }
 
-int ConfigManager::getInt(const String &key, const String &domName) const {
-	String value(get(key, domName));
+static int parseIntValue(const String &value, const String &key, const String &domName) {
 	char *errpos;
 
 	// For now, be tolerant against missing config keys. Strictly spoken, it is
@@ -489,8 +551,7 @@ int ConfigManager::getInt(const String &key, const String &domName) const {
 	return ivalue;
 }
 
-bool ConfigManager::getBool(const String &key, const String &domName) const {
-	String value(get(key, domName));
+static bool parseBoolValue(const String &value, const String &key, const String &domName) {
 	bool val;
 	if (parseBool(value, val))
 		return val;
@@ -499,6 +560,33 @@ bool ConfigManager::getBool(const String &key, const String &domName) const {
 	      key.c_str(), domName.c_str(), value.c_str());
 }
 
+int ConfigManager::getInt(const String &key, const String &domName) const {
+	return parseIntValue(get(key, domName), key, domName);
+}
+
+bool ConfigManager::getBool(const String &key, const String &domName) const {
+	return parseBoolValue(get(key, domName), key, domName);
+}
+
+const String &ConfigManager::get(const KeyHandle &key) const {
+	// The value found last time can only be different (or gone) after a
+	// change, all of which advance _generation
+	if (key._generation != _generation) {
+		key._value = &get(key._key);
+		key._generation = _generation;
+	}
+
+	return *key._value;
+}
+
+int ConfigManager::getInt(const KeyHandle &key) const {
+	return parseIntValue(get(key), key._key, String());
+}
+
+bool ConfigManager::getBool(const KeyHandle &key) const {
+	return parseBoolValue(get(key), key._key, String());
+}
+
 
 #pragma mark -
 
@@ -506,6 +594,7 @@ bool ConfigManager::getBool(const String &key, const String &domName) const {
 void ConfigManager::set(const String &key, const String &value) {
 	// Remove the transient domain value, if any.
 	_transientDomain.erase(key);
+	++_generation;
 
 	// Write the new key/value pair into the active domain, resp. into
 	// the application domain if no game domain is active.
@@ -574,6 +663,7 @@ void ConfigManager::setBool(const String &key, bool value, const String &domName
 
 void ConfigManager::registerDefault(const String &key, const String &value) {
 	_defaultsDomain[key] = value;
+	++_generation;
 }
 
 void ConfigManager::registerDefault(const String &key, const char *value) {
@@ -600,6 +690,7 @@ void ConfigManager::setActiveDomain(const String &domName) {
 		_activeDomain = &_gameDomains[domName];
 	}
 	_activeDomainName = domName;
+	++_generation;
 }
 
 void ConfigManager::addGameDomain(const String &domName) {
@@ -611,9 +702,15 @@ void ConfigManager::addGameDomain(const String &domName) {
 
 	_gameDomains[domName];
 
+	addToSaveOrder(domName);
+}
+
+void ConfigManager::addToSaveOrder(const String &domName) {
 	// Add it to the _domainSaveOrder, if it's not already in there
-	if (find(_domainSaveOrder.begin(), _domainSaveOrder.end(), domName) == _domainSaveOrder.end())
+	if (!_domainsInSaveOrder.contains(domName)) {
 		_domainSaveOrder.push_back(domName);
+		_domainsInSaveOrder[domName] = true;
+	}
 }
 
 void ConfigManager::addMiscDomain(const String &domName) {
@@ -631,6 +728,7 @@ void ConfigManager::removeGameDomain(const String &domName) {
 		_activeDomain = 0;
 	}
 	_gameDomains.erase(domName);
+	++_generation;
 }
 
 void ConfigManager::removeMiscDomain(const String &domName) {
@@ -646,6 +744,7 @@ void ConfigManager::renameGameDomain(const String &oldName, const String &newNam
 		_activeDomainName = newName;
 		_activeDomain = &_gameDomains[newName];
 	}
+	++_generation;
 }
 
 void ConfigManager::renameMiscDomain(const String &oldName, const String &newName) {
@@ -61,6 +61,8 @@ public:
 
 		bool contains(const String &key) const { return _entries.contains(key); }
 
+		const_iterator find(const String &key) const { return _entries.find(key); }
+
 		String &operator[](const String &key) { return _entries[key]; }
 		const String &operator[](const String &key) const { return _entries[key]; }
 
@@ -83,6 +85,26 @@ public:
 
 	typedef HashMap<String, Domain, IgnoreCase_Hash, IgnoreCase_EqualTo> DomainMap;
 
+	/**
+	 * A handle for a key which is queried very often, e.g. every frame.
+	 * It remembers the value get() found for the key, until anything is
+	 * changed through the ConfigManager (which includes requesting a
+	 * modifiable domain). Then the key is looked up again.
+	 */
+	class KeyHandle {
+	public:
+		explicit KeyHandle(const String &key) : _key(key), _value(0), _generation(0) {}
+
+		const String &getKey() const { return _key; }
+
+	private:
+		friend class ConfigManager;
+
+		String _key;
+		mutable const String *_value;
+		mutable uint32 _generation;
+	};
+
 	/** The name of the application domain (normally 'scummvm'). */
 	static char const *const kApplicationDomain;
 
@@ -97,6 +119,17 @@ public:
 	void				loadDefaultConfigFile();
 	void				loadConfigFile(const String &filename);
 
+	/**
+	 * Replace the configuration with the one read from a stream, in the
+	 * format of the config file.
+	 */
+	void				loadFromStream(SeekableReadStream &stream);
+
+	/**
+	 * Write the configuration to a stream, in the format of the config file.
+	 */
+	void				saveToStream(WriteStream &stream) const;
+
 	/**
 	 * Retrieve the config domain with the given name.
 	 * @param domName	the name of the domain to retrieve
@@ -138,16 +171,34 @@ public:
 	void				setInt(const String &key, int value, const String &domName = String());
 	void				setBool(const String &key, bool value, const String &domName = String());
 
+	//
+	// Access methods for keys queried very often: Like the generic ones,
+	// but the key is only looked up again after the configuration changed.
+	//
+	const String &		get(const KeyHandle &key) const;
+	int					getInt(const KeyHandle &key) const;
+	bool				getBool(const KeyHandle &key) const;
+
 
 	void				registerDefault(const String &key, const String &value);
 	void				registerDefault(const String &key, const char *value);
 	void				registerDefault(const String &key, int value);
 	void				registerDefault(const String &key, bool value);
 
+	/**
+	 * Write the configuration to the config file, unless it has not changed
+	 * since it was last loaded or written.
+	 */
 	void				flushToDisk();
 
+	/**
+	 * Check whether the configuration has changed since the config file
+	 * was last loaded or written. Changes which were reverted do not count.
+	 */
+	bool				isFlushed() const;
+
 	void				setActiveDomain(const String &domName);
-	Domain *			getActiveDomain() { return _activeDomain; }
+	Domain *			getActiveDomain() { ++_generation; return _activeDomain; }
 	const Domain *		getActiveDomain() const { return _activeDomain; }
 	const String &		getActiveDomainName() const { return _activeDomainName; }
 
@@ -163,7 +214,7 @@ public:
 	bool				hasMiscDomain(const String &domName) const;
 
 	const DomainMap &	getGameDomains() const { return _gameDomains; }
-	DomainMap::iterator beginGameDomains() { return _gameDomains.begin(); }
+	DomainMap::iterator beginGameDomains() { ++_generation; return _gameDomains.begin(); }
 	DomainMap::iterator endGameDomains() { return _gameDomains.end(); }
 
 	static void			defragment();	// move in memory to reduce fragmentation
@@ -173,10 +224,10 @@ private:
 	friend class Singleton<SingletonBaseType>;
 	ConfigManager();
 
-	void			loadFromStream(SeekableReadStream &stream);
 	void			addDomain(const String &domainName, const Domain &domain);
-	void			writeDomain(WriteStream &stream, const String &name, const Domain &domain);
+	void			writeDomain(WriteStream &stream, const String &name, const Domain &domain) const;
 	void			renameDomain(const String &oldName, const String &newName, DomainMap &map);
+	void			addToSaveOrder(const String &domName);
 
 	Domain			_transientDomain;
 	DomainMap		_gameDomains;
@@ -189,6 +240,11 @@ private:
 #endif
 
 	Array<String>	_domainSaveOrder;
+	HashMap<String, bool> _domainsInSaveOrder;	// The names in _domainSaveOrder, for quick lookup
+
+	String			_flushedMD5;	// Checksum of the config file as last loaded or written
+
+	uint32			_generation;	// Changed whenever KeyHandles must look their key up again
 
 	String			_activeDomainName;
 	Domain *		_activeDomain;
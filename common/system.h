@@ -703,6 +703,28 @@ public:
 	 */
 	virtual void updateScreen() = 0;
 
+	/**
+	 * Statistics about the frame most recently presented by updateScreen().
+	 */
+	struct FrameStatistics {
+		uint32 frameCount;  ///< Number of frames presented so far
+		uint32 presentTime; ///< getMillis() value when the frame was presented
+		uint32 updateTime;  ///< CPU time spent in updateScreen, in microseconds
+		uint32 scalerTime;  ///< Part of updateTime spent scaling, 0 if scaling is not done by the CPU
+		uint32 dirtyPixels; ///< Number of screen pixels redrawn for the frame
+	};
+
+	/**
+	 * Query statistics about the frame most recently presented to the
+	 * display. This allows to diagnose stutter and to tell how expensive
+	 * screen updates are. Calls to updateScreen() which did not need to
+	 * redraw anything do not change the statistics.
+	 *
+	 * @param stats	the statistics are stored here
+	 * @return true if the backend supports frame statistics, false otherwise
+	 */
+	virtual bool getFrameStatistics(FrameStatistics &stats) const { return false; }
+
 	/**
 	 * Set current shake position, a feature needed for some SCUMM screen
 	 * effects. The effect causes the displayed graphics to be shifted upwards
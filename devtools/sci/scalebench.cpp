@@ -0,0 +1,109 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// Measures how many scaled cels per second GfxView::drawScaled() can draw,
+// with the scaled cel built for every draw (as before scaled cels were
+// cached) and with a cached one. The scaling is the engine's own
+// scaleCelBitmap(); the draw loop is a copy of the one in drawScaled(),
+// drawing into plain visual and priority buffers instead of GfxScreen.
+//
+// Build it from a configured build directory, e.g.:
+//   g++ -O2 -DHAVE_CONFIG_H -I. -I$SRC -I$SRC/engines -o scalebench
+//       $SRC/devtools/sci/scalebench.cpp $SRC/engines/sci/graphics/celscale.cpp
+// where $SRC is the ScummVM source directory.
+//
+// Usage: scalebench [scale [iterations]]
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/scummsys.h"
+#include "common/util.h"
+#include "sci/graphics/celscale.h"
+
+enum {
+	kScreenWidth = 320,
+	kScreenHeight = 200,
+	kCelWidth = 60,
+	kCelHeight = 110,
+	kClearKey = 255
+};
+
+static byte visual[kScreenWidth * kScreenHeight];
+static byte priorityMap[kScreenWidth * kScreenHeight];
+
+static void drawCel(const byte *bitmap, int width, int height, int left, int top, byte priority) {
+	for (int y = 0; y < height; y++) {
+		const byte *row = bitmap + y * width;
+		for (int x = 0; x < width; x++) {
+			const byte color = row[x];
+			const int offset = (top + y) * kScreenWidth + left + x;
+			if (color != kClearKey && priority >= priorityMap[offset]) {
+				visual[offset] = color;
+				priorityMap[offset] = priority;
+			}
+		}
+	}
+}
+
+static double celsPerSecond(bool cached, int scale, int iterations) {
+	static byte cel[kCelWidth * kCelHeight];
+	static byte scaled[kCelWidth * 4 * kCelHeight * 4];
+	const int scaledWidth = MIN<int>((kCelWidth * scale) >> 7, kScreenWidth);
+	const int scaledHeight = MIN<int>((kCelHeight * scale) >> 7, kScreenHeight);
+
+	// Some transparency, like the outline of an actor
+	for (int i = 0; i < kCelWidth * kCelHeight; i++)
+		cel[i] = (i % kCelWidth < 8 || i % kCelWidth >= kCelWidth - 8) ? kClearKey : (byte)(i * 7);
+	memset(priorityMap, 0, sizeof(priorityMap));
+
+	if (cached)
+		Sci::scaleCelBitmap(scaled, scaledWidth, scaledHeight, cel, kCelWidth, kCelHeight, scale, scale);
+
+	const clock_t start = clock();
+	for (int i = 0; i < iterations; i++) {
+		if (!cached)
+			Sci::scaleCelBitmap(scaled, scaledWidth, scaledHeight, cel, kCelWidth, kCelHeight, scale, scale);
+		drawCel(scaled, scaledWidth, scaledHeight, (i * 3) % (kScreenWidth - scaledWidth + 1), (i * 5) % (kScreenHeight - scaledHeight + 1), i & 15);
+	}
+	const double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	return seconds > 0 ? iterations / seconds : 0;
+}
+
+int main(int argc, char **argv) {
+	const int scale = (argc > 1) ? atoi(argv[1]) : 100;
+	const int iterations = (argc > 2) ? atoi(argv[2]) : 200000;
+
+	if (scale <= 0 || scale > 512 || iterations <= 0) {
+		printf("Usage: %s [scale (1-512, 128 = 100%%) [iterations]]\n", argv[0]);
+		return 1;
+	}
+
+	printf("%dx%d cel at scale %d/128, %d draws\n", kCelWidth, kCelHeight, scale, iterations);
+	printf("scaled every draw: %.0f cels/s\n", celsPerSecond(false, scale, iterations));
+	printf("cached:            %.0f cels/s\n", celsPerSecond(true, scale, iterations));
+	return 0;
+}
@@ -115,6 +115,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("list",				WRAP_METHOD(Console, cmdList));
 	registerCmd("hexgrep",			WRAP_METHOD(Console, cmdHexgrep));
 	registerCmd("verify_scripts",		WRAP_METHOD(Console, cmdVerifyScripts));
+	registerCmd("decompressor_stats",	WRAP_METHOD(Console, cmdDecompressorStats));
 	// Game
 	registerCmd("save_game",			WRAP_METHOD(Console, cmdSaveGame));
 	registerCmd("restore_game",		WRAP_METHOD(Console, cmdRestoreGame));
@@ -139,6 +140,9 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("pl",                 WRAP_METHOD(Console, cmdPlaneList));	// alias
 	registerCmd("plane_items",        WRAP_METHOD(Console, cmdPlaneItemList));
 	registerCmd("pi",                 WRAP_METHOD(Console, cmdPlaneItemList));	// alias
+	registerCmd("frameout_stats",     WRAP_METHOD(Console, cmdFrameoutStats));
+	registerCmd("gfxcache_stats",     WRAP_METHOD(Console, cmdGfxCacheStats));
+	registerCmd("robot_stats",        WRAP_METHOD(Console, cmdRobotStats));
 	registerCmd("saved_bits",         WRAP_METHOD(Console, cmdSavedBits));
 	registerCmd("show_saved_bits",    WRAP_METHOD(Console, cmdShowSavedBits));
 	// Segments
@@ -148,6 +152,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("seginfo",			WRAP_METHOD(Console, cmdSegmentInfo));			// alias
 	registerCmd("segment_kill",		WRAP_METHOD(Console, cmdKillSegment));
 	registerCmd("segkill",			WRAP_METHOD(Console, cmdKillSegment));			// alias
+	registerCmd("object_cache_stats",	WRAP_METHOD(Console, cmdObjectCacheStats));
 	// Garbage collection
 	registerCmd("gc",					WRAP_METHOD(Console, cmdGCInvoke));
 	registerCmd("gc_objects",			WRAP_METHOD(Console, cmdGCObjects));
@@ -190,6 +195,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("send",				WRAP_METHOD(Console, cmdSend));
 	registerCmd("go",					WRAP_METHOD(Console, cmdGo));
 	registerCmd("logkernel",          WRAP_METHOD(Console, cmdLogKernel));
+	registerCmd("avoidpath_stats",    WRAP_METHOD(Console, cmdAvoidPathStats));
 	// Breakpoints
 	registerCmd("bp_list",			WRAP_METHOD(Console, cmdBreakpointList));
 	registerCmd("bplist",				WRAP_METHOD(Console, cmdBreakpointList));			// alias
@@ -311,6 +317,12 @@ void Console::postEnter() {
 		_videoFrameDelay = 0;
 	}
 
+#ifdef ENABLE_SCI32
+	// Videos and some of the commands draw over the game screen
+	if (_engine->_gfxFrameout)
+		_engine->_gfxFrameout->forceFullUpdate();
+#endif
+
 	_engine->pauseEngine(false);
 }
 
@@ -359,6 +371,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" list - Lists all the resources of a given type\n");
 	debugPrintf(" hexgrep - Searches some resources for a particular sequence of bytes, represented as hexadecimal numbers\n");
 	debugPrintf(" verify_scripts - Performs sanity checks on SCI1.1-SCI2.1 game scripts (e.g. if they're up to 64KB in total)\n");
+	debugPrintf(" decompressor_stats - Shows how many resources were unpacked and the time it took, per compression method\n");
 	debugPrintf("\n");
 	debugPrintf("Game:\n");
 	debugPrintf(" save_game - Saves the current game state to the hard disk\n");
@@ -381,6 +394,9 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" window_list / wl - Shows a list of all the windows (ports) in the draw list (SCI0 - SCI1.1)\n");
 	debugPrintf(" plane_list / pl - Shows a list of all the planes in the draw list (SCI2+)\n");
 	debugPrintf(" plane_items / pi - Shows a list of all items for a plane (SCI2+)\n");
+	debugPrintf(" frameout_stats - Shows screen update statistics of kFrameout (SCI2+)\n");
+	debugPrintf(" gfxcache_stats - Shows statistics of the view and font cache\n");
+	debugPrintf(" robot_stats - Shows playback statistics of robot videos (SCI2+)\n");
 	debugPrintf(" saved_bits - List saved bits on the hunk\n");
 	debugPrintf(" show_saved_bits - Display saved bits\n");
 	debugPrintf("\n");
@@ -388,6 +404,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" segment_table / segtable - Lists all segments\n");
 	debugPrintf(" segment_info / seginfo - Provides information on the specified segment\n");
 	debugPrintf(" segment_kill / segkill - Deletes the specified segment\n");
+	debugPrintf(" object_cache_stats - Shows how often object lookups were answered by the object cache\n");
 	debugPrintf("\n");
 	debugPrintf("Garbage collection:\n");
 	debugPrintf(" gc - Invokes the garbage collector\n");
@@ -424,6 +441,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" send - Sends a message to an object\n");
 	debugPrintf(" go - Executes the script\n");
 	debugPrintf(" logkernel - Logs kernel calls\n");
+	debugPrintf(" avoidpath_stats - Shows kAvoidPath visibility cache statistics\n");
 	debugPrintf("\n");
 	debugPrintf("Breakpoints:\n");
 	debugPrintf(" bp_list / bplist / bl - Lists the current breakpoints\n");
@@ -1064,6 +1082,53 @@ bool Console::cmdVerifyScripts(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdDecompressorStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Shows how many resources were unpacked and the time it took, per compression method,\n");
+		debugPrintf("and the sizes of the batches of resources announced by kLoad.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		_engine->getResMan()->resetDecompressorStats();
+		debugPrintf("Statistics reset\n");
+		return true;
+	}
+
+	static const struct {
+		ResourceCompression compression;
+		const char *name;
+	} compressionNames[] = {
+		{ kCompNone,      "none" },
+		{ kCompLZW,       "LZW" },
+		{ kCompHuffman,   "Huffman" },
+		{ kCompLZW1,      "LZW1" },
+		{ kCompLZW1View,  "LZW1 view" },
+		{ kCompLZW1Pic,   "LZW1 pic" },
+#ifdef ENABLE_SCI32
+		{ kCompSTACpack,  "STACpack" },
+#endif
+		{ kCompDCL,       "DCL" }
+	};
+
+	for (int i = 0; i < ARRAYSIZE(compressionNames); i++) {
+		const DecompressorStats &stats = _engine->getResMan()->getDecompressorStats(compressionNames[i].compression);
+		if (!stats.resources)
+			continue;
+
+		debugPrintf("%-10s %5d resources, %8d -> %8d bytes, %5d ms\n", compressionNames[i].name,
+		            stats.resources, stats.packedBytes, stats.unpackedBytes, stats.time);
+	}
+
+	const PreloadStats &preloadStats = _engine->getResMan()->getPreloadStats();
+	if (preloadStats.batches) {
+		debugPrintf("Preloaded %d batches: %d resources queued, %d read, %d in the largest batch\n",
+		            preloadStats.batches, preloadStats.queued, preloadStats.loaded, preloadStats.largestBatch);
+	}
+	return true;
+}
+
 // Same as in sound/drivers/midi.cpp
 uint8 getGmInstrument(const Mt32ToGmMap &Mt32Ins) {
 	if (Mt32Ins.gmInstr == MIDI_MAPPED_TO_RHYTHM)
@@ -1794,6 +1859,87 @@ bool Console::cmdPlaneItemList(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdFrameoutStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Shows statistics of the screen updates done by kFrameout.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+#ifdef ENABLE_SCI32
+	if (_engine->_gfxFrameout) {
+		FrameoutStats &stats = _engine->_gfxFrameout->getStats();
+
+		if (argc == 2) {
+			stats.reset();
+			debugPrintf("Statistics reset\n");
+			return true;
+		}
+
+		debugPrintf("Frames: %d, unchanged: %d, full screen updates: %d\n", stats.frames, stats.framesSkipped, stats.fullUpdates);
+		debugPrintf("Items drawn: %d, pixels updated: %d\n", stats.itemsDrawn, stats.pixelsTouched);
+		debugPrintf("Last frame: %d items drawn, %d pixels in %d rects updated\n",
+		            stats.lastItemsDrawn, stats.lastPixelsTouched, stats.lastDirtyRects);
+	} else {
+		debugPrintf("This SCI version does not use kFrameout\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
+bool Console::cmdGfxCacheStats(int argc, const char **argv) {
+	GfxCacheStats &stats = _engine->_gfxCache->getStats();
+
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Shows statistics of the view and font cache.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		stats.reset();
+		debugPrintf("Statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("Views: %d cached, %d of %d KB used\n", _engine->_gfxCache->getViewCount(),
+	            _engine->_gfxCache->getViewCacheSize() / 1024, MAX_CACHED_VIEWS_SIZE / 1024);
+	debugPrintf("View hits: %d, misses: %d, evictions: %d\n", stats.viewHits, stats.viewMisses, stats.viewEvictions);
+	debugPrintf("Fonts: %d of %d cached\n", _engine->_gfxCache->getFontCount(), MAX_CACHED_FONTS);
+	debugPrintf("Font hits: %d, misses: %d, evictions: %d\n", stats.fontHits, stats.fontMisses, stats.fontEvictions);
+	return true;
+}
+
+bool Console::cmdRobotStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Shows playback statistics of robot videos.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+#ifdef ENABLE_SCI32
+	if (_engine->_robotDecoder) {
+		RobotStats &stats = _engine->_robotDecoder->getStats();
+
+		if (argc == 2) {
+			stats.reset();
+			debugPrintf("Statistics reset\n");
+			return true;
+		}
+
+		debugPrintf("Frames shown: %d, decoded ahead: %d\n", stats.framesShown, stats.framesDecodedAhead);
+		debugPrintf("Late frames: %d, maximum lateness: %d ms\n", stats.framesLate, stats.maxLateness);
+	} else {
+		debugPrintf("This SCI version does not have robot videos\n");
+	}
+#else
+	debugPrintf("SCI32 isn't included in this compiled executable\n");
+#endif
+	return true;
+}
+
 bool Console::cmdSavedBits(int argc, const char **argv) {
 	SegManager *segman = _engine->_gamestate->_segMan;
 	SegmentId id = segman->findSegmentByType(SEG_TYPE_HUNK);
@@ -2201,6 +2347,30 @@ bool Console::cmdKillSegment(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdObjectCacheStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Shows how often object lookups were answered by the object cache.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	SegManager *segMan = _engine->_gamestate->_segMan;
+
+	if (argc == 2) {
+		segMan->resetObjectCacheStats();
+		debugPrintf("Statistics reset\n");
+		return true;
+	}
+
+	const SegManager::ObjectCacheStats &stats = segMan->getObjectCacheStats();
+	const uint32 lookups = stats.hits + stats.misses;
+	debugPrintf("Object lookups: %d, found in cache: %d (%d%%)\n", lookups, stats.hits,
+	            lookups ? (int)((uint64)stats.hits * 100 / lookups) : 0);
+	debugPrintf("Cache cleared %d times\n", stats.clears);
+
+	return true;
+}
+
 bool Console::cmdShowMap(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Switches to one of the following screen maps\n");
@@ -3535,6 +3705,28 @@ bool Console::cmdLogKernel(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdAvoidPathStats(int argc, const char **argv) {
+	AvoidPathCache &cache = _engine->_gamestate->_avoidPathCache;
+
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Shows statistics of the kAvoidPath visibility cache.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		cache.resetStats();
+		debugPrintf("Statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("Path queries: %d, same polygons as before: %d\n", cache._queries, cache._hits);
+	debugPrintf("Vertices in current polygon set: %d\n", cache._vertexCount);
+	debugPrintf("Visibility rows computed: %d\n", cache._rowsComputed);
+	debugPrintf("A* vertex expansions: %d\n", cache._expansions);
+	return true;
+}
+
 bool Console::cmdBreakpointList(int argc, const char **argv) {
 	int i = 0;
 	int bpdata;
@@ -45,6 +45,22 @@ enum ResourceCompression {
 	kCompDCL
 };
 
+/**
+ * Statistics about the resources unpacked with one compression method.
+ */
+struct DecompressorStats {
+	uint32 resources;
+	uint32 packedBytes;
+	uint32 unpackedBytes;
+	uint32 time; ///< in ms
+
+	DecompressorStats() { reset(); }
+
+	void reset() {
+		resources = packedBytes = unpackedBytes = time = 0;
+	}
+};
+
 /**
  * Base class for decompressors.
  * Simply copies nPacked bytes from src to dest.
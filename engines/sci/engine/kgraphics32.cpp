@@ -484,6 +484,7 @@ reg_t kBitmap(EngineState *s, int argc, reg_t *argv) {
 		int entrySize = width * height + BITMAP_HEADER_SIZE;
 		reg_t memoryId = s->_segMan->allocateHunkEntry("Bitmap()", entrySize);
 		byte *memoryPtr = s->_segMan->getHunkPointer(memoryId);
+		g_sci->_gfxText32->textBitmapChanged(memoryId);
 		memset(memoryPtr, 0, BITMAP_HEADER_SIZE);	// zero out the bitmap header
 		memset(memoryPtr + BITMAP_HEADER_SIZE, back, width * height);
 		// Save totalWidth, totalHeight
@@ -514,6 +515,7 @@ reg_t kBitmap(EngineState *s, int argc, reg_t *argv) {
 		uint16 y = argv[6].toUint16();
 
 		byte *memoryPtr = s->_segMan->getHunkPointer(hunkId);
+		g_sci->_gfxText32->textBitmapChanged(hunkId);
 		// Get totalWidth, totalHeight
 		uint16 totalWidth = READ_LE_UINT16(memoryPtr);
 		uint16 totalHeight = READ_LE_UINT16(memoryPtr + 2);
@@ -555,6 +557,7 @@ reg_t kBitmap(EngineState *s, int argc, reg_t *argv) {
 		uint16 foreColor = 255;	// TODO
 
 		byte *memoryPtr = s->_segMan->getHunkPointer(hunkId);
+		g_sci->_gfxText32->textBitmapChanged(hunkId);
 		// Get totalWidth, totalHeight
 		uint16 totalWidth = READ_LE_UINT16(memoryPtr);
 		uint16 totalHeight = READ_LE_UINT16(memoryPtr + 2);
@@ -598,6 +601,7 @@ reg_t kBitmap(EngineState *s, int argc, reg_t *argv) {
 		uint16 back = argv[6].toUint16();
 
 		byte *memoryPtr = s->_segMan->getHunkPointer(hunkId);
+		g_sci->_gfxText32->textBitmapChanged(hunkId);
 		// Get totalWidth, totalHeight
 		uint16 totalWidth = READ_LE_UINT16(memoryPtr);
 		uint16 totalHeight = READ_LE_UINT16(memoryPtr + 2);
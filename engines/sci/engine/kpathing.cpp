@@ -111,10 +111,14 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// Index in the cached visibility matrix, -1 for start and end points
+	int index;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = NULL;
+		index = -1;
 	}
 };
 
@@ -257,7 +261,12 @@ struct PathfindingState {
 	// Screen size
 	int _width, _height;
 
-	PathfindingState(int width, int height) : _width(width), _height(height) {
+	// Visibility cache and whether it applies to the current polygon set
+	AvoidPathCache *_cache;
+	bool _useCache;
+
+	PathfindingState(int width, int height, AvoidPathCache *cache) : _width(width), _height(height), _cache(cache) {
+		_useCache = false;
 		vertex_start = NULL;
 		vertex_end = NULL;
 		vertex_index = NULL;
@@ -659,6 +668,68 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+/**
+ * Checks whether a vertex can be seen from another one without crossing a polygon.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex to look from
+ * @param vertex		the vertex to look at
+ * @return true if vertex is visible from vertex_cur
+ */
+static bool is_visible(PathfindingState *s, Vertex *vertex_cur, Vertex *vertex) {
+	// Make sure we don't intersect a polygon locally at the vertices
+	if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
+		return false;
+
+	// Check for intersecting edges
+	for (int j = 0; j < s->vertices; j++) {
+		Vertex *edge = s->vertex_index[j];
+		if (VERTEX_HAS_EDGES(edge)) {
+			if (between(vertex_cur->v, vertex->v, edge->v)) {
+				// If we hit a vertex, make sure we can pass through it without intersecting its polygon
+				if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
+					return false;
+
+				// This edge won't properly intersect, so we continue
+				continue;
+			}
+
+			if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Returns the cached visibility of all polygon vertices from a polygon vertex,
+ * computing it first if this is the first time it's needed.
+ * @param s				the pathfinding state
+ * @param vertex_cur	the vertex, which must have a cache index
+ * @return row of the visibility matrix, one bit per vertex index
+ */
+static const uint32 *visibility_row(PathfindingState *s, Vertex *vertex_cur) {
+	AvoidPathCache *cache = s->_cache;
+	const uint rowSize = (cache->_vertexCount + 31) / 32;
+	uint32 *row = &cache->_visibility[vertex_cur->index * rowSize];
+
+	if (!cache->_rowValid[vertex_cur->index]) {
+		memset(row, 0, rowSize * sizeof(uint32));
+
+		for (int i = 0; i < s->vertices; i++) {
+			Vertex *vertex = s->vertex_index[i];
+
+			if (vertex->index >= 0 && is_visible(s, vertex_cur, vertex))
+				row[vertex->index >> 5] |= 1 << (vertex->index & 31);
+		}
+
+		cache->_rowValid[vertex_cur->index] = 1;
+		cache->_rowsComputed++;
+	}
+
+	return row;
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
@@ -667,34 +738,22 @@ static int inside(const Common::Point &p, Vertex *vertex) {
  */
 static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 	VertexList *visVerts = new VertexList();
+	const uint32 *row = NULL;
+
+	if (s->_useCache && vertex_cur->index >= 0)
+		row = visibility_row(s, vertex_cur);
 
 	for (int i = 0; i < s->vertices; i++) {
 		Vertex *vertex = s->vertex_index[i];
+		bool visible;
 
-		// Make sure we don't intersect a polygon locally at the vertices
-		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
-			continue;
-
-		// Check for intersecting edges
-		int j;
-		for (j = 0; j < s->vertices; j++) {
-			Vertex *edge = s->vertex_index[j];
-			if (VERTEX_HAS_EDGES(edge)) {
-				if (between(vertex_cur->v, vertex->v, edge->v)) {
-					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
-					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
-						break;
-
-					// This edge won't properly intersect, so we continue
-					continue;
-				}
-
-				if (intersect_proper(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
-					break;
-			}
-		}
+		// Start and end points aren't in the cache, as they move on every call
+		if (row && vertex->index >= 0)
+			visible = (row[vertex->index >> 5] >> (vertex->index & 31)) & 1;
+		else
+			visible = is_visible(s, vertex_cur, vertex);
 
-		if (j == s->vertices)
+		if (visible)
 			visVerts->push_front(vertex);
 	}
 
@@ -1081,8 +1140,10 @@ static Vertex *merge_point(PathfindingState *s, const Common::Point &v) {
 				Vertex *next = CLIST_NEXT(vertex);
 
 				if (between(vertex->v, next->v, v)) {
-					// Split edge by adding vertex
+					// Split edge by adding vertex. This changes the edges
+					// the cached visibility was computed with.
 					polygon->vertices.insertAfter(vertex, v_new);
+					s->_useCache = false;
 					return v_new;
 				}
 			}
@@ -1185,6 +1246,45 @@ static void change_polygons_opt_0(PathfindingState *s) {
 	}
 }
 
+/**
+ * Numbers the polygon vertices and checks whether the visibility cache was
+ * computed for the same polygons. Otherwise the cache is reset to match them.
+ * Parameters: (PathfindingState *) s: The pathfinding state
+ */
+static void lookup_avoid_path_cache(PathfindingState *s) {
+	AvoidPathCache *cache = s->_cache;
+	Common::Array<int16> key;
+	int count = 0;
+
+	for (PolygonList::iterator it = s->polygons.begin(); it != s->polygons.end(); ++it) {
+		Polygon *polygon = *it;
+		Vertex *vertex;
+
+		key.push_back(polygon->vertices.size());
+
+		CLIST_FOREACH(vertex, &polygon->vertices) {
+			vertex->index = count++;
+			key.push_back(vertex->v.x);
+			key.push_back(vertex->v.y);
+		}
+	}
+
+	cache->_queries++;
+	s->_useCache = true;
+
+	if (key == cache->_polygons) {
+		cache->_hits++;
+		return;
+	}
+
+	cache->_polygons = key;
+	cache->_vertexCount = count;
+	cache->_visibility.clear();
+	cache->_visibility.resize(count * ((count + 31) / 32));
+	cache->_rowValid.clear();
+	cache->_rowValid.resize(count);
+}
+
 /**
  * Converts the SCI input data for pathfinding
  * Parameters: (EngineState *) s: The game state
@@ -1199,7 +1299,7 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	SegManager *segMan = s->_segMan;
 	Polygon *polygon;
 	int count = 0;
-	PathfindingState *pf_s = new PathfindingState(width, height);
+	PathfindingState *pf_s = new PathfindingState(width, height, &s->_avoidPathCache);
 
 	// Convert all polygons
 	if (poly_list.getSegment()) {
@@ -1276,6 +1376,8 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 		}
 	}
 
+	lookup_avoid_path_cache(pf_s);
+
 	// Merge start and end points into polygon set
 	pf_s->vertex_start = merge_point(pf_s, *new_start);
 	pf_s->vertex_end = merge_point(pf_s, *new_end);
@@ -1344,6 +1446,7 @@ static void AStar(PathfindingState *s) {
 		// Move vertex from set open to set closed
 		closedSet.push_front(vertex_min);
 		openSet.erase(vertex_min_it);
+		s->_cache->_expansions++;
 
 		VertexList *visVerts = visible_vertices(s, vertex_min);
 
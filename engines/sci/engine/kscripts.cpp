@@ -42,6 +42,11 @@ reg_t kLoad(EngineState *s, int argc, reg_t *argv) {
 	if (restype == kResourceTypeMemory)
 		return s->_segMan->allocateHunkEntry("kLoad()", resnr);
 
+	// Rooms load all of their views and pictures at once, so read them in
+	// one go when the first one is used
+	if (restype == kResourceTypeView || restype == kResourceTypePic)
+		g_sci->getResMan()->preloadResource(ResourceId(restype, resnr));
+
 	return make_reg(0, ((restype << 11) | resnr)); // Return the resource identifier as handle
 }
 
@@ -42,6 +42,7 @@
 #ifdef ENABLE_SCI32
 #include "video/coktel_decoder.h"
 #include "sci/video/robot_decoder.h"
+#include "sci/graphics/frameout.h"
 #endif
 
 namespace Sci {
@@ -131,6 +132,12 @@ void playVideo(Video::VideoDecoder *videoDecoder, VideoState videoState) {
 
 	delete[] scaleBuffer;
 	delete videoDecoder;
+
+#ifdef ENABLE_SCI32
+	// The video was drawn over the game screen
+	if (g_sci->_gfxFrameout)
+		g_sci->_gfxFrameout->forceFullUpdate();
+#endif
 }
 
 reg_t kShowMovie(EngineState *s, int argc, reg_t *argv) {
@@ -622,17 +622,13 @@ const byte *Script::getSci3ObjectsPointer() {
 }
 
 Object *Script::getObject(uint16 offset) {
-	if (_objects.contains(offset))
-		return &_objects[offset];
-	else
-		return 0;
+	ObjMap::iterator it = _objects.find(offset);
+	return (it != _objects.end()) ? &it->_value : 0;
 }
 
 const Object *Script::getObject(uint16 offset) const {
-	if (_objects.contains(offset))
-		return &_objects[offset];
-	else
-		return 0;
+	ObjMap::const_iterator it = _objects.find(offset);
+	return (it != _objects.end()) ? &it->_value : 0;
 }
 
 Object *Script::scriptObjInit(reg_t obj_pos, bool fullObjectInit) {
@@ -40,6 +40,8 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_saveDirPtr = NULL_REG;
 	_parserPtr = NULL_REG;
 
+	clearObjectCache();
+
 #ifdef ENABLE_SCI32
 	_arraysSegId = 0;
 	_stringSegId = 0;
@@ -155,6 +157,7 @@ void SegManager::deallocate(SegmentId seg) {
 	if (mobj->getType() == SEG_TYPE_SCRIPT) {
 		Script *scr = (Script *)mobj;
 		_scriptSegMap.erase(scr->getScriptNumber());
+		clearObjectCache();
 		if (scr->getLocalsSegment()) {
 			// Check if the locals segment has already been deallocated.
 			// If the locals block has been stored in a segment with an ID
@@ -226,7 +229,22 @@ SegmentObj *SegManager::getSegment(SegmentId seg, SegmentType type) const {
 	return getSegmentType(seg) == type ? _heap[seg] : NULL;
 }
 
+void SegManager::clearObjectCache() {
+	for (uint i = 0; i < kObjectCacheSize; i++) {
+		_objectCache[i].pos = NULL_REG;
+		_objectCache[i].obj = NULL;
+	}
+	_objectCacheStats.clears++;
+}
+
 Object *SegManager::getObject(reg_t pos) const {
+	ObjectCacheEntry &entry = _objectCache[(pos.getSegment() * 97 + pos.getOffset()) & (kObjectCacheSize - 1)];
+	if (entry.obj && entry.pos == pos) {
+		_objectCacheStats.hits++;
+		return entry.obj;
+	}
+	_objectCacheStats.misses++;
+
 	SegmentObj *mobj = getSegmentObj(pos.getSegment());
 	Object *obj = NULL;
 
@@ -242,6 +260,10 @@ Object *SegManager::getObject(reg_t pos) const {
 			if (pos.getOffset() <= scr->getBufSize() && pos.getOffset() >= (uint)-SCRIPT_OBJECT_MAGIC_OFFSET
 			        && scr->offsetIsObject(pos.getOffset())) {
 				obj = scr->getObject(pos.getOffset());
+				if (obj) {
+					entry.pos = pos;
+					entry.obj = obj;
+				}
 			}
 		}
 	}
@@ -977,6 +999,7 @@ int SegManager::instantiateScript(int scriptNum) {
 			return segmentId;
 		} else {
 			scr->freeScript();
+			clearObjectCache();
 		}
 	} else {
 		scr = allocateScript(scriptNum, &segmentId);
@@ -987,6 +1010,9 @@ int SegManager::instantiateScript(int scriptNum) {
 	scr->initializeClasses(this);
 	scr->initializeObjects(this, segmentId);
 
+	// Objects which failed to initialize have been removed again
+	clearObjectCache();
+
 	return segmentId;
 }
 
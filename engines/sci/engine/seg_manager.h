@@ -441,6 +441,18 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	struct ObjectCacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 clears;
+
+		ObjectCacheStats() { reset(); }
+		void reset() { hits = misses = clears = 0; }
+	};
+
+	const ObjectCacheStats &getObjectCacheStats() const { return _objectCacheStats; }
+	void resetObjectCacheStats() { _objectCacheStats.reset(); }
+
 private:
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
@@ -464,6 +476,24 @@ private:
 	SegmentId _stringSegId;
 #endif
 
+	// Script objects found by getObject(), in a direct mapped table indexed
+	// by their address. Objects stay at the same place in their script's
+	// object map until the script is reloaded or freed, which is when the
+	// table has to be cleared.
+	enum {
+		kObjectCacheSize = 256
+	};
+
+	struct ObjectCacheEntry {
+		reg_t pos;
+		Object *obj;
+	};
+
+	mutable ObjectCacheEntry _objectCache[kObjectCacheSize];
+	mutable ObjectCacheStats _objectCacheStats;
+
+	void clearObjectCache();
+
 public:
 	SegmentObj *allocSegment(SegmentObj *mem, SegmentId *segid);
 
@@ -95,6 +95,36 @@ struct VideoState {
 	}
 };
 
+/**
+ * Visibility between the vertices of the last polygon set given to
+ * kAvoidPath. Rooms usually pass the same obstacles on every call, so rows
+ * of the visibility matrix are kept until the polygons change.
+ */
+struct AvoidPathCache {
+	// Vertex count and points of every polygon, in the order they were
+	// converted
+	Common::Array<int16> _polygons;
+	uint _vertexCount;
+
+	// One row of bits per vertex, filled in when first needed
+	Common::Array<uint32> _visibility;
+	Common::Array<byte> _rowValid;
+
+	// Statistics
+	uint32 _queries;
+	uint32 _hits;
+	uint32 _rowsComputed;
+	uint32 _expansions;
+
+	AvoidPathCache() : _vertexCount(0) {
+		resetStats();
+	}
+
+	void resetStats() {
+		_queries = _hits = _rowsComputed = _expansions = 0;
+	}
+};
+
 struct EngineState : public Common::Serializable {
 public:
 	EngineState(SegManager *segMan);
@@ -205,6 +235,8 @@ public:
 
 	uint16 _palCycleToColor;
 
+	AvoidPathCache _avoidPathCache;
+
 	/**
 	 * Resets the engine state.
 	 */
@@ -35,7 +35,7 @@
 namespace Sci {
 
 GfxCache::GfxCache(ResourceManager *resMan, GfxScreen *screen, GfxPalette *palette)
-	: _resMan(resMan), _screen(screen), _palette(palette) {
+	: _resMan(resMan), _screen(screen), _palette(palette), _useCounter(0) {
 }
 
 GfxCache::~GfxCache() {
@@ -45,8 +45,8 @@ GfxCache::~GfxCache() {
 
 void GfxCache::purgeFontCache() {
 	for (FontCache::iterator iter = _cachedFonts.begin(); iter != _cachedFonts.end(); ++iter) {
-		delete iter->_value;
-		iter->_value = 0;
+		delete iter->_value.font;
+		iter->_value.font = 0;
 	}
 
 	_cachedFonts.clear();
@@ -54,36 +54,93 @@ void GfxCache::purgeFontCache() {
 
 void GfxCache::purgeViewCache() {
 	for (ViewCache::iterator iter = _cachedViews.begin(); iter != _cachedViews.end(); ++iter) {
-		delete iter->_value;
-		iter->_value = 0;
+		delete iter->_value.view;
+		iter->_value.view = 0;
 	}
 
 	_cachedViews.clear();
 }
 
+void GfxCache::shrinkFontCache(uint maxCount) {
+	while (_cachedFonts.size() > maxCount) {
+		FontCache::iterator oldest = _cachedFonts.begin();
+		for (FontCache::iterator iter = _cachedFonts.begin(); iter != _cachedFonts.end(); ++iter) {
+			if (iter->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = iter;
+		}
+
+		delete oldest->_value.font;
+		_cachedFonts.erase(oldest);
+		_stats.fontEvictions++;
+	}
+}
+
+void GfxCache::shrinkViewCache(uint32 maxSize) {
+	uint32 size = getViewCacheSize();
+
+	while (size > maxSize && _cachedViews.size() > 1) {
+		ViewCache::iterator oldest = _cachedViews.begin();
+		for (ViewCache::iterator iter = _cachedViews.begin(); iter != _cachedViews.end(); ++iter) {
+			if (iter->_value.lastUsed < oldest->_value.lastUsed)
+				oldest = iter;
+		}
+
+		size -= oldest->_value.view->getMemoryUsage();
+		delete oldest->_value.view;
+		_cachedViews.erase(oldest);
+		_stats.viewEvictions++;
+	}
+}
+
+uint32 GfxCache::getViewCacheSize() const {
+	uint32 size = 0;
+	for (ViewCache::const_iterator iter = _cachedViews.begin(); iter != _cachedViews.end(); ++iter)
+		size += iter->_value.view->getMemoryUsage();
+	return size;
+}
+
 GfxFont *GfxCache::getFont(GuiResourceId fontId) {
-	if (_cachedFonts.size() >= MAX_CACHED_FONTS)
-		purgeFontCache();
-
-	if (!_cachedFonts.contains(fontId)) {
-		// Create special SJIS font in japanese games, when font 900 is selected
-		if ((fontId == 900) && (g_sci->getLanguage() == Common::JA_JPN))
-			_cachedFonts[fontId] = new GfxFontSjis(_screen, fontId);
-		else
-			_cachedFonts[fontId] = new GfxFontFromResource(_resMan, _screen, fontId);
+	FontCache::iterator iter = _cachedFonts.find(fontId);
+	if (iter != _cachedFonts.end()) {
+		iter->_value.lastUsed = ++_useCounter;
+		_stats.fontHits++;
+		return iter->_value.font;
 	}
 
-	return _cachedFonts[fontId];
+	_stats.fontMisses++;
+	shrinkFontCache(MAX_CACHED_FONTS - 1);
+
+	FontCacheEntry &entry = _cachedFonts[fontId];
+	// Create special SJIS font in japanese games, when font 900 is selected
+	if ((fontId == 900) && (g_sci->getLanguage() == Common::JA_JPN))
+		entry.font = new GfxFontSjis(_screen, fontId);
+	else
+		entry.font = new GfxFontFromResource(_resMan, _screen, fontId);
+	entry.lastUsed = ++_useCounter;
+
+	return entry.font;
 }
 
 GfxView *GfxCache::getView(GuiResourceId viewId) {
-	if (_cachedViews.size() >= MAX_CACHED_VIEWS)
-		purgeViewCache();
+	ViewCache::iterator iter = _cachedViews.find(viewId);
+	if (iter != _cachedViews.end()) {
+		iter->_value.lastUsed = ++_useCounter;
+		_stats.viewHits++;
+		return iter->_value.view;
+	}
+
+	_stats.viewMisses++;
+
+	ViewCacheEntry &entry = _cachedViews[viewId];
+	entry.view = new GfxView(_resMan, _screen, _palette, viewId);
+	entry.lastUsed = ++_useCounter;
+	GfxView *view = entry.view;
 
-	if (!_cachedViews.contains(viewId))
-		_cachedViews[viewId] = new GfxView(_resMan, _screen, _palette, viewId);
+	// Cels are unpacked while views are in the cache, so the size is only
+	// checked when a new view gets added
+	shrinkViewCache(MAX_CACHED_VIEWS_SIZE);
 
-	return _cachedViews[viewId];
+	return view;
 }
 
 int16 GfxCache::kernelViewGetCelWidth(GuiResourceId viewId, int16 loopNo, int16 celNo) {
@@ -30,11 +30,42 @@ namespace Sci {
 class GfxFont;
 class GfxView;
 
-typedef Common::HashMap<int, GfxFont *> FontCache;
-typedef Common::HashMap<int, GfxView *> ViewCache;
+struct FontCacheEntry {
+	GfxFont *font;
+	uint32 lastUsed;
+};
+
+struct ViewCacheEntry {
+	GfxView *view;
+	uint32 lastUsed;
+};
+
+typedef Common::HashMap<int, FontCacheEntry> FontCache;
+typedef Common::HashMap<int, ViewCacheEntry> ViewCache;
+
+struct GfxCacheStats {
+	uint32 fontHits;
+	uint32 fontMisses;
+	uint32 fontEvictions;
+	uint32 viewHits;
+	uint32 viewMisses;
+	uint32 viewEvictions;
+
+	GfxCacheStats() { reset(); }
+
+	void reset() {
+		fontHits = fontMisses = fontEvictions = 0;
+		viewHits = viewMisses = viewEvictions = 0;
+	}
+};
 
 /**
  * Cache class, handles caching of views/fonts
+ *
+ * Views are kept along with their unpacked cels until the memory used by all
+ * of them exceeds MAX_CACHED_VIEWS_SIZE, then the least recently used ones
+ * are removed. Fonts are removed the same way once there are more than
+ * MAX_CACHED_FONTS of them.
  */
 class GfxCache {
 public:
@@ -51,16 +82,35 @@ public:
 
 	byte kernelViewGetColorAtCoordinate(GuiResourceId viewId, int16 loopNo, int16 celNo, int16 x, int16 y);
 
+	uint getFontCount() const { return _cachedFonts.size(); }
+	uint getViewCount() const { return _cachedViews.size(); }
+	uint32 getViewCacheSize() const;
+	GfxCacheStats &getStats() { return _stats; }
+
 private:
 	void purgeFontCache();
 	void purgeViewCache();
 
+	/**
+	 * Remove the least recently used fonts until at most maxCount are left.
+	 */
+	void shrinkFontCache(uint maxCount);
+
+	/**
+	 * Remove the least recently used views until they take up at most
+	 * maxSize bytes. The view requested last is always kept.
+	 */
+	void shrinkViewCache(uint32 maxSize);
+
 	ResourceManager *_resMan;
 	GfxScreen *_screen;
 	GfxPalette *_palette;
 
 	FontCache _cachedFonts;
 	ViewCache _cachedViews;
+	uint32 _useCounter;
+
+	GfxCacheStats _stats;
 };
 
 } // End of namespace Sci
@@ -0,0 +1,80 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "common/util.h"
+
+#include "sci/graphics/celscale.h"
+
+namespace Sci {
+
+/**
+ * We don't fully follow sierra sci here, I did the scaling algo myself and it
+ * is definitely not pixel-perfect with the one sierra is using. It shouldn't
+ * matter because the scaled cel rect is definitely the same as in sierra sci.
+ */
+void scaleCelBitmap(byte *dst, int16 scaledWidth, int16 scaledHeight, const byte *src, int16 celWidth, int16 celHeight, int16 scaleX, int16 scaleY) {
+	uint16 scalingX[640];
+	uint16 scalingY[480];
+	int pixelNo, scaledPixel, scaledPixelNo, prevScaledPixelNo;
+
+	assert(scaledWidth <= ARRAYSIZE(scalingX) && scaledHeight <= ARRAYSIZE(scalingY));
+
+	// Create height scaling table
+	pixelNo = 0;
+	scaledPixel = scaledPixelNo = prevScaledPixelNo = 0;
+	while (pixelNo < celHeight) {
+		scaledPixelNo = scaledPixel >> 7;
+		assert(scaledPixelNo < ARRAYSIZE(scalingY));
+		for (; prevScaledPixelNo <= scaledPixelNo; prevScaledPixelNo++)
+			scalingY[prevScaledPixelNo] = pixelNo;
+		pixelNo++;
+		scaledPixel += scaleY;
+	}
+	pixelNo--;
+	scaledPixelNo++;
+	for (; scaledPixelNo < scaledHeight; scaledPixelNo++)
+		scalingY[scaledPixelNo] = pixelNo;
+
+	// Create width scaling table
+	pixelNo = 0;
+	scaledPixel = scaledPixelNo = prevScaledPixelNo = 0;
+	while (pixelNo < celWidth) {
+		scaledPixelNo = scaledPixel >> 7;
+		assert(scaledPixelNo < ARRAYSIZE(scalingX));
+		for (; prevScaledPixelNo <= scaledPixelNo; prevScaledPixelNo++)
+			scalingX[prevScaledPixelNo] = pixelNo;
+		pixelNo++;
+		scaledPixel += scaleX;
+	}
+	pixelNo--;
+	scaledPixelNo++;
+	for (; scaledPixelNo < scaledWidth; scaledPixelNo++)
+		scalingX[scaledPixelNo] = pixelNo;
+
+	for (int y = 0; y < scaledHeight; y++) {
+		const byte *srcRow = src + scalingY[y] * celWidth;
+		for (int x = 0; x < scaledWidth; x++)
+			*dst++ = srcRow[scalingX[x]];
+	}
+}
+
+} // End of namespace Sci
@@ -0,0 +1,48 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef SCI_GRAPHICS_CELSCALE_H
+#define SCI_GRAPHICS_CELSCALE_H
+
+#include "common/scummsys.h"
+
+namespace Sci {
+
+/**
+ * Scale a cel bitmap by scaleX / 128 horizontally and scaleY / 128
+ * vertically, the way GfxView::drawScaled() draws it.
+ *
+ * @param dst           buffer for the scaled bitmap, scaledWidth *
+ *                      scaledHeight bytes (at most 640 * 480)
+ * @param scaledWidth   width of the scaled bitmap
+ * @param scaledHeight  height of the scaled bitmap
+ * @param src           the unscaled cel bitmap
+ * @param celWidth      width of the unscaled cel
+ * @param celHeight     height of the unscaled cel
+ * @param scaleX        horizontal scale, 128 is the original size
+ * @param scaleY        vertical scale, 128 is the original size
+ */
+void scaleCelBitmap(byte *dst, int16 scaledWidth, int16 scaledHeight, const byte *src, int16 celWidth, int16 celHeight, int16 scaleX, int16 scaleY);
+
+} // End of namespace Sci
+
+#endif
@@ -66,6 +66,9 @@ GfxFrameout::GfxFrameout(SegManager *segMan, ResourceManager *resMan, GfxCoordAd
 	_curScrollText = -1;
 	_showScrollText = false;
 	_maxScrollTexts = 0;
+	_lastShowScrollText = false;
+	_lastScrollText = -1;
+	_forceFullUpdate = true;
 }
 
 GfxFrameout::~GfxFrameout() {
@@ -77,11 +80,14 @@ void GfxFrameout::clear() {
 	_planes.clear();
 	deletePlanePictures(NULL_REG);
 	clearScrollTexts();
+	_lastDrawList.clear();
+	_forceFullUpdate = true;
 }
 
 void GfxFrameout::clearScrollTexts() {
 	_scrollTexts.clear();
 	_curScrollText = -1;
+	_forceFullUpdate = true;
 }
 
 void GfxFrameout::addScrollTextEntry(Common::String &text, reg_t kWindow, uint16 x, uint16 y, bool replace) {
@@ -104,6 +110,7 @@ void GfxFrameout::addScrollTextEntry(Common::String &text, reg_t kWindow, uint16
 		_scrollTexts.pop_back();
 		_scrollTexts.push_back(textEntry);
 	}
+	_forceFullUpdate = true;
 }
 
 void GfxFrameout::showCurrentScrollText() {
@@ -275,10 +282,12 @@ void GfxFrameout::addPlanePicture(reg_t object, GuiResourceId pictureId, uint16
 	newPicture.startY = startY;
 	newPicture.pictureCels = 0;
 	_planePictures.push_back(newPicture);
+	_forceFullUpdate = true;
 }
 
 void GfxFrameout::deletePlanePictures(reg_t object) {
 	PlanePictureList::iterator it = _planePictures.begin();
+	_forceFullUpdate = true;
 
 	while (it != _planePictures.end()) {
 		if (it->object == object || object.isNull()) {
@@ -303,6 +312,7 @@ reg_t GfxFrameout::addPlaneLine(reg_t object, Common::Point startPoint, Common::
 			line.priority = priority;
 			line.control = control;
 			it->lines.push_back(line);
+			_forceFullUpdate = true;
 			return line.hunkId;
 		}
 	}
@@ -324,6 +334,7 @@ void GfxFrameout::updatePlaneLine(reg_t object, reg_t hunkId, Common::Point star
 					it2->color = color;
 					it2->priority = priority;
 					it2->control = control;
+					_forceFullUpdate = true;
 					return;
 				}
 			}
@@ -342,6 +353,7 @@ void GfxFrameout::deletePlaneLine(reg_t object, reg_t hunkId) {
 				if (it2->hunkId == hunkId) {
 					_segMan->freeHunkEntry(hunkId);
 					it2 = it->lines.erase(it2);
+					_forceFullUpdate = true;
 					return;
 				}
 			}
@@ -555,8 +567,14 @@ void GfxFrameout::showVideo() {
 				skipVideo = true;
 		}
 
-		g_system->delayMillis(10);
+		// Use the time until the next frame is due to decode the following
+		// ones, so that slow frames don't hold up playback
+		if (!videoDecoder->decodeAhead())
+			g_system->delayMillis(10);
 	}
+
+	// The video was drawn over the game screen
+	_forceFullUpdate = true;
 }
 
 void GfxFrameout::createPlaneItemList(reg_t planeObject, FrameoutList &itemList) {
@@ -651,6 +669,355 @@ void GfxFrameout::drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int1
 	//	warning("picture cel %d %d", itemEntry->celNo, itemEntry->priority);
 }
 
+bool FrameoutDrawItem::sameState(const FrameoutDrawItem &other) const {
+	return x == other.x && y == other.y && celRect == other.celRect &&
+	       translatedClipRect == other.translatedClipRect &&
+	       viewId == other.viewId && loopNo == other.loopNo && celNo == other.celNo &&
+	       scaleX == other.scaleX && scaleY == other.scaleY && priority == other.priority &&
+	       hasText == other.hasText && textChecksum == other.textChecksum;
+}
+
+bool FrameoutDrawPlane::sameState(const FrameoutDrawPlane &other) const {
+	return visible == other.visible &&
+	       planeOffsetX == other.planeOffsetX && planeOffsetY == other.planeOffsetY &&
+	       pictureId == other.pictureId && planeRect == other.planeRect &&
+	       planeClipRect == other.planeClipRect &&
+	       planePictureMirrored == other.planePictureMirrored && planeBack == other.planeBack;
+}
+
+void GfxFrameout::prepareScreenItem(PlaneEntry &plane, FrameoutEntry *itemEntry, FrameoutDrawPlane &drawPlane) {
+	GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
+	int16 dummyX = 0;
+
+	if (view && view->isSci2Hires()) {
+		view->adjustToUpscaledCoordinates(itemEntry->y, itemEntry->x);
+		view->adjustToUpscaledCoordinates(itemEntry->z, dummyX);
+	} else if (getSciVersion() >= SCI_VERSION_2_1_EARLY) {
+		_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
+		_coordAdjuster->fromScriptToDisplay(itemEntry->z, dummyX);
+	}
+
+	// Adjust according to current scroll position
+	itemEntry->x -= plane.planeOffsetX;
+	itemEntry->y -= plane.planeOffsetY;
+
+	uint16 useInsetRect = readSelectorValue(_segMan, itemEntry->object, SELECTOR(useInsetRect));
+	if (useInsetRect) {
+		itemEntry->celRect.top = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inTop));
+		itemEntry->celRect.left = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inLeft));
+		itemEntry->celRect.bottom = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inBottom));
+		itemEntry->celRect.right = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inRight));
+		if (view && view->isSci2Hires()) {
+			view->adjustToUpscaledCoordinates(itemEntry->celRect.top, itemEntry->celRect.left);
+			view->adjustToUpscaledCoordinates(itemEntry->celRect.bottom, itemEntry->celRect.right);
+		}
+		itemEntry->celRect.translate(itemEntry->x, itemEntry->y);
+		// TODO: maybe we should clip the cels rect with this, i'm not sure
+		//  the only currently known usage is game menu of gk1
+	} else if (view) {
+		// Process global scaling, if needed.
+		// TODO: Seems like SCI32 always processes global scaling for scaled objects
+		// TODO: We can only process symmetrical scaling for now (i.e. same value for scaleX/scaleY)
+		if ((itemEntry->scaleSignal & kScaleSignalDoScaling32) &&
+		   !(itemEntry->scaleSignal & kScaleSignalDisableGlobalScaling32) &&
+		    (itemEntry->scaleX == itemEntry->scaleY) &&
+			itemEntry->scaleX != 128)
+			applyGlobalScaling(itemEntry, plane.planeRect, view->getHeight(itemEntry->loopNo, itemEntry->celNo));
+
+		if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
+			view->getCelRect(itemEntry->loopNo, itemEntry->celNo,
+				itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->celRect);
+		else
+			view->getCelScaledRect(itemEntry->loopNo, itemEntry->celNo,
+				itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->scaleX,
+				itemEntry->scaleY, itemEntry->celRect);
+
+		Common::Rect nsRect = itemEntry->celRect;
+		// Translate back to actual coordinate within scrollable plane
+		nsRect.translate(plane.planeOffsetX, plane.planeOffsetY);
+
+		if (g_sci->getGameId() == GID_PHANTASMAGORIA2) {
+			// HACK: Some (?) objects in Phantasmagoria 2 have no NS rect. Skip them for now.
+			// TODO: Remove once we figure out how Phantasmagoria 2 draws objects on screen.
+			if (lookupSelector(_segMan, itemEntry->object, SELECTOR(nsLeft), NULL, NULL) != kSelectorVariable)
+				return;
+		}
+
+		if (view && view->isSci2Hires()) {
+			view->adjustBackUpscaledCoordinates(nsRect.top, nsRect.left);
+			view->adjustBackUpscaledCoordinates(nsRect.bottom, nsRect.right);
+			g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
+		} else if (getSciVersion() >= SCI_VERSION_2_1_EARLY && _resMan->detectHires()) {
+			_coordAdjuster->fromDisplayToScript(nsRect.top, nsRect.left);
+			_coordAdjuster->fromDisplayToScript(nsRect.bottom, nsRect.right);
+			g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
+		}
+
+		// TODO: For some reason, the top left nsRect coordinates get
+		// swapped in the GK1 inventory screen, investigate why.
+		// This is also needed for GK1 rooms 710 and 720 (catacombs, inner and
+		// outer circle), for handling the tiles and talking to Wolfgang.
+		// HACK: Fix the coordinates by explicitly setting them here for GK1.
+		// Also check bug #6729, for another case where this is needed.
+		if (g_sci->getGameId() == GID_GK1)
+			g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
+	}
+
+	// Don't attempt to draw sprites that are outside the visible
+	// screen area. An example is the random people walking in
+	// Jackson Square in GK1.
+	if (itemEntry->celRect.bottom < 0 || itemEntry->celRect.top  >= _screen->getDisplayHeight() ||
+	    itemEntry->celRect.right  < 0 || itemEntry->celRect.left >= _screen->getDisplayWidth())
+		return;
+
+	Common::Rect clipRect, translatedClipRect;
+	clipRect = itemEntry->celRect;
+
+	if (view && view->isSci2Hires()) {
+		clipRect.clip(plane.upscaledPlaneClipRect);
+		translatedClipRect = clipRect;
+		translatedClipRect.translate(plane.upscaledPlaneRect.left, plane.upscaledPlaneRect.top);
+	} else {
+		// QFG4 passes invalid rectangles when a battle is starting
+		if (!clipRect.isValidRect())
+			return;
+		clipRect.clip(plane.planeClipRect);
+		translatedClipRect = clipRect;
+		translatedClipRect.translate(plane.planeRect.left, plane.planeRect.top);
+	}
+
+	FrameoutDrawItem item;
+	item.entry = itemEntry;
+	item.clipRect = clipRect;
+	item.translatedClipRect = translatedClipRect;
+	item.hasText = lookupSelector(_segMan, itemEntry->object, SELECTOR(text), NULL, NULL) == kSelectorVariable;
+
+	item.object = itemEntry->object;
+	item.x = itemEntry->x;
+	item.y = itemEntry->y;
+	item.celRect = itemEntry->celRect;
+	item.viewId = itemEntry->viewId;
+	item.loopNo = itemEntry->loopNo;
+	item.celNo = itemEntry->celNo;
+	item.scaleX = itemEntry->scaleX;
+	item.scaleY = itemEntry->scaleY;
+	item.priority = itemEntry->priority;
+	if (item.hasText) {
+		item.textRect = g_sci->_gfxText32->getTextBitmapRect(itemEntry->x, itemEntry->y, plane.planeRect, itemEntry->object);
+		item.textChecksum = g_sci->_gfxText32->getTextBitmapChecksum(itemEntry->object);
+	} else {
+		item.textChecksum = 0;
+	}
+	drawPlane.items.push_back(item);
+}
+
+void GfxFrameout::drawPlane(const FrameoutDrawPlane &drawPlane) {
+	PlaneEntry *plane = drawPlane.entry;
+
+	// Draw any plane lines, if they exist
+	// These are drawn on invisible planes as well. (e.g. "invisiblePlane" in LSL6 hires)
+	// FIXME: Lines aren't always drawn (e.g. when the narrator speaks in LSL6 hires).
+	// Perhaps something is painted over them?
+	for (PlaneLineList::iterator it2 = plane->lines.begin(); it2 != plane->lines.end(); ++it2) {
+		Common::Point startPoint = it2->startPoint;
+		Common::Point endPoint = it2->endPoint;
+		_coordAdjuster->kernelLocalToGlobal(startPoint.x, startPoint.y, plane->object);
+		_coordAdjuster->kernelLocalToGlobal(endPoint.x, endPoint.y, plane->object);
+		_screen->drawLine(startPoint, endPoint, it2->color, it2->priority, it2->control);
+	}
+
+	if (!drawPlane.visible) {
+		// If plane was shown before, delete plane rect
+		if (drawPlane.clearRect)
+			_paint32->fillRect(plane->planeRect, 0);
+		return;
+	}
+
+	// There is a race condition lurking in SQ6, which causes the game to hang in the intro, when teleporting to Polysorbate LX.
+	// Since I first wrote the patch, the race has stopped occurring for me though.
+	// I'll leave this for investigation later, when someone can reproduce.
+	//if (plane->pictureId == kPlanePlainColored)	// FIXME: This is what SSCI does, and fixes the intro of LSL7, but breaks the dialogs in GK1 (adds black boxes)
+	if (plane->pictureId == kPlanePlainColored && (plane->planeBack || g_sci->getGameId() != GID_GK1))
+		_paint32->fillRect(plane->planeRect, plane->planeBack);
+
+	_coordAdjuster->pictureSetDisplayArea(plane->planeRect);
+
+	for (uint i = 0; i < drawPlane.items.size(); i++) {
+		const FrameoutDrawItem &item = drawPlane.items[i];
+		FrameoutEntry *itemEntry = item.entry;
+
+		_stats.lastItemsDrawn++;
+
+		if (item.object.isNull()) {
+			// Picture cel data
+			drawPicture(itemEntry, plane->planeOffsetX, plane->planeOffsetY, plane->planePictureMirrored);
+			continue;
+		}
+
+		// The view is looked up again, as views of earlier items might have
+		// been removed from the cache since
+		GfxView *view = (item.viewId != 0xFFFF) ? _cache->getView(item.viewId) : NULL;
+		if (view && !item.clipRect.isEmpty()) {
+			if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
+				view->draw(itemEntry->celRect, item.clipRect, item.translatedClipRect,
+					itemEntry->loopNo, itemEntry->celNo, 255, 0, view->isSci2Hires());
+			else
+				view->drawScaled(itemEntry->celRect, item.clipRect, item.translatedClipRect,
+					itemEntry->loopNo, itemEntry->celNo, 255, itemEntry->scaleX, itemEntry->scaleY);
+		}
+
+		// Draw text, if it exists
+		if (item.hasText)
+			g_sci->_gfxText32->drawTextBitmap(itemEntry->x, itemEntry->y, plane->planeRect, itemEntry->object);
+	}
+}
+
+namespace {
+
+// Above this number of dirty rects, they are merged into their bounding box
+enum {
+	kMaxFrameoutDirtyRects = 16
+};
+
+void addDirtyRect(Common::Array<Common::Rect> &dirtyRects, const Common::Rect &rect) {
+	if (rect.isEmpty())
+		return;
+
+	// Merge the rect with all rects it overlaps, the result might then
+	// overlap other ones
+	Common::Rect area = rect;
+	for (uint i = 0; i < dirtyRects.size();) {
+		if (dirtyRects[i].intersects(area)) {
+			area.extend(dirtyRects[i]);
+			dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			i++;
+		}
+	}
+
+	if (dirtyRects.size() >= kMaxFrameoutDirtyRects) {
+		for (uint i = 0; i < dirtyRects.size(); i++)
+			area.extend(dirtyRects[i]);
+		dirtyRects.clear();
+	}
+
+	dirtyRects.push_back(area);
+}
+
+void addItemRects(Common::Array<Common::Rect> &dirtyRects, const FrameoutDrawItem &item) {
+	if (item.viewId != 0xFFFF)
+		addDirtyRect(dirtyRects, item.translatedClipRect);
+
+	if (item.hasText)
+		addDirtyRect(dirtyRects, item.textRect);
+}
+
+const FrameoutDrawItem *findDrawItem(const Common::Array<FrameoutDrawItem> &items, reg_t object) {
+	for (uint i = 0; i < items.size(); i++) {
+		if (items[i].object == object)
+			return &items[i];
+	}
+	return 0;
+}
+
+} // End of anonymous namespace
+
+void GfxFrameout::findChangedRects(const FrameoutDrawList &drawList, Common::Array<Common::Rect> &dirtyRects) {
+	for (uint planeNr = 0; planeNr < drawList.size(); planeNr++) {
+		const FrameoutDrawPlane &plane = drawList[planeNr];
+		const FrameoutDrawPlane *lastPlane = 0;
+		uint lastPlaneNr;
+
+		for (lastPlaneNr = 0; lastPlaneNr < _lastDrawList.size(); lastPlaneNr++) {
+			if (_lastDrawList[lastPlaneNr].object == plane.object) {
+				lastPlane = &_lastDrawList[lastPlaneNr];
+				break;
+			}
+		}
+
+		// New, moved and reordered planes change their whole area
+		if (!lastPlane || lastPlaneNr != planeNr || !plane.sameState(*lastPlane)) {
+			if (lastPlane && lastPlane->visible)
+				addDirtyRect(dirtyRects, lastPlane->planeRect);
+			if (plane.visible || plane.clearRect)
+				addDirtyRect(dirtyRects, plane.planeRect);
+			continue;
+		}
+
+		if (!plane.visible)
+			continue;
+
+		// Picture cels don't change unless the plane does, so only screen
+		// items have to be compared
+		for (uint i = 0; i < plane.items.size(); i++) {
+			const FrameoutDrawItem &item = plane.items[i];
+			if (item.object.isNull())
+				continue;
+
+			const FrameoutDrawItem *lastItem = findDrawItem(lastPlane->items, item.object);
+			if (!lastItem) {
+				addItemRects(dirtyRects, item);
+			} else if (!item.sameState(*lastItem)) {
+				addItemRects(dirtyRects, *lastItem);
+				addItemRects(dirtyRects, item);
+			}
+		}
+
+		for (uint i = 0; i < lastPlane->items.size(); i++) {
+			const FrameoutDrawItem &lastItem = lastPlane->items[i];
+			if (!lastItem.object.isNull() && !findDrawItem(plane.items, lastItem.object))
+				addItemRects(dirtyRects, lastItem);
+		}
+	}
+
+	// Removed planes
+	for (uint lastPlaneNr = 0; lastPlaneNr < _lastDrawList.size(); lastPlaneNr++) {
+		const FrameoutDrawPlane &lastPlane = _lastDrawList[lastPlaneNr];
+		bool found = false;
+
+		for (uint planeNr = 0; planeNr < drawList.size(); planeNr++) {
+			if (drawList[planeNr].object == lastPlane.object) {
+				found = true;
+				break;
+			}
+		}
+
+		if (!found && lastPlane.visible)
+			addDirtyRect(dirtyRects, lastPlane.planeRect);
+	}
+
+	// Clip the rects to the screen
+	const Common::Rect screenRect(_screen->getDisplayWidth(), _screen->getDisplayHeight());
+	for (uint i = 0; i < dirtyRects.size();) {
+		dirtyRects[i].clip(screenRect);
+		if (dirtyRects[i].isEmpty())
+			dirtyRects.remove_at(i);
+		else
+			i++;
+	}
+}
+
+void GfxFrameout::updateScreen(const Common::Array<Common::Rect> &dirtyRects, bool fullUpdate) {
+	_stats.lastPixelsTouched = 0;
+	_stats.lastDirtyRects = 0;
+
+	if (fullUpdate) {
+		_screen->copyToScreen();
+		_stats.lastPixelsTouched = _screen->getDisplayWidth() * _screen->getDisplayHeight();
+		_stats.fullUpdates++;
+	} else {
+		for (uint i = 0; i < dirtyRects.size(); i++) {
+			_screen->copyRectToScreen(dirtyRects[i]);
+			_stats.lastPixelsTouched += dirtyRects[i].width() * dirtyRects[i].height();
+		}
+		_stats.lastDirtyRects = dirtyRects.size();
+	}
+
+	_stats.itemsDrawn += _stats.lastItemsDrawn;
+	_stats.pixelsTouched += _stats.lastPixelsTouched;
+}
+
 void GfxFrameout::kernelFrameout() {
 	if (g_sci->_robotDecoder->isVideoLoaded()) {
 		showVideo();
@@ -659,20 +1026,26 @@ void GfxFrameout::kernelFrameout() {
 
 	_palette->palVaryUpdate();
 
+	// Work out the state of all planes and screen items first. The frame is
+	// only drawn when something changed since the previous one, and only the
+	// changed parts of the screen are passed on to the backend.
+	FrameoutDrawList drawList;
+
 	for (PlaneList::iterator it = _planes.begin(); it != _planes.end(); it++) {
 		reg_t planeObject = it->object;
 
-		// Draw any plane lines, if they exist
-		// These are drawn on invisible planes as well. (e.g. "invisiblePlane" in LSL6 hires)
-		// FIXME: Lines aren't always drawn (e.g. when the narrator speaks in LSL6 hires).
-		// Perhaps something is painted over them?
-		for (PlaneLineList::iterator it2 = it->lines.begin(); it2 != it->lines.end(); ++it2) {
-			Common::Point startPoint = it2->startPoint;
-			Common::Point endPoint = it2->endPoint;
-			_coordAdjuster->kernelLocalToGlobal(startPoint.x, startPoint.y, it->object);
-			_coordAdjuster->kernelLocalToGlobal(endPoint.x, endPoint.y, it->object);
-			_screen->drawLine(startPoint, endPoint, it2->color, it2->priority, it2->control);
-		}
+		drawList.push_back(FrameoutDrawPlane());
+		FrameoutDrawPlane &drawPlane = drawList.back();
+		drawPlane.entry = &*it;
+		drawPlane.clearRect = false;
+		drawPlane.object = planeObject;
+		drawPlane.planeOffsetX = it->planeOffsetX;
+		drawPlane.planeOffsetY = it->planeOffsetY;
+		drawPlane.pictureId = it->pictureId;
+		drawPlane.planeRect = it->planeRect;
+		drawPlane.planeClipRect = it->planeClipRect;
+		drawPlane.planePictureMirrored = it->planePictureMirrored;
+		drawPlane.planeBack = it->planeBack;
 
 		int16 planeLastPriority = it->lastPriority;
 
@@ -680,21 +1053,12 @@ void GfxFrameout::kernelFrameout() {
 		int16 planePriority = it->priority = readSelectorValue(_segMan, planeObject, SELECTOR(priority));
 
 		it->lastPriority = planePriority;
+		drawPlane.visible = (planePriority >= 0);
 		if (planePriority < 0) { // Plane currently not meant to be shown
-			// If plane was shown before, delete plane rect
-			if (planePriority != planeLastPriority)
-				_paint32->fillRect(it->planeRect, 0);
+			drawPlane.clearRect = (planePriority != planeLastPriority);
 			continue;
 		}
 
-		// There is a race condition lurking in SQ6, which causes the game to hang in the intro, when teleporting to Polysorbate LX.
-		// Since I first wrote the patch, the race has stopped occurring for me though.
-		// I'll leave this for investigation later, when someone can reproduce.
-		//if (it->pictureId == kPlanePlainColored)	// FIXME: This is what SSCI does, and fixes the intro of LSL7, but breaks the dialogs in GK1 (adds black boxes)
-		if (it->pictureId == kPlanePlainColored && (it->planeBack || g_sci->getGameId() != GID_GK1))
-			_paint32->fillRect(it->planeRect, it->planeBack);
-
-		_coordAdjuster->pictureSetDisplayArea(it->planeRect);
 		// Invoking drewPicture() with an invalid picture ID in SCI32 results in
 		// invalidating the palVary palette when a palVary effect is active. This
 		// is quite obvious in QFG4, where the day time palette is incorrectly
@@ -718,138 +1082,57 @@ void GfxFrameout::kernelFrameout() {
 				_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
 				_coordAdjuster->fromScriptToDisplay(itemEntry->picStartY, itemEntry->picStartX);
 
-				if (!isPictureOutOfView(itemEntry, it->planeRect, it->planeOffsetX, it->planeOffsetY))
-					drawPicture(itemEntry, it->planeOffsetX, it->planeOffsetY, it->planePictureMirrored);
-			} else {
-				GfxView *view = (itemEntry->viewId != 0xFFFF) ? _cache->getView(itemEntry->viewId) : NULL;
-				int16 dummyX = 0;
-
-				if (view && view->isSci2Hires()) {
-					view->adjustToUpscaledCoordinates(itemEntry->y, itemEntry->x);
-					view->adjustToUpscaledCoordinates(itemEntry->z, dummyX);
-				} else if (getSciVersion() >= SCI_VERSION_2_1_EARLY) {
-					_coordAdjuster->fromScriptToDisplay(itemEntry->y, itemEntry->x);
-					_coordAdjuster->fromScriptToDisplay(itemEntry->z, dummyX);
+				if (!isPictureOutOfView(itemEntry, it->planeRect, it->planeOffsetX, it->planeOffsetY)) {
+					FrameoutDrawItem item;
+					item.entry = itemEntry;
+					item.viewId = 0xFFFF;
+					item.hasText = false;
+					item.object = NULL_REG;
+					drawPlane.items.push_back(item);
 				}
+			} else {
+				prepareScreenItem(*it, itemEntry, drawPlane);
+			}
+		}
+	}
 
-				// Adjust according to current scroll position
-				itemEntry->x -= it->planeOffsetX;
-				itemEntry->y -= it->planeOffsetY;
-
-				uint16 useInsetRect = readSelectorValue(_segMan, itemEntry->object, SELECTOR(useInsetRect));
-				if (useInsetRect) {
-					itemEntry->celRect.top = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inTop));
-					itemEntry->celRect.left = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inLeft));
-					itemEntry->celRect.bottom = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inBottom));
-					itemEntry->celRect.right = readSelectorValue(_segMan, itemEntry->object, SELECTOR(inRight));
-					if (view && view->isSci2Hires()) {
-						view->adjustToUpscaledCoordinates(itemEntry->celRect.top, itemEntry->celRect.left);
-						view->adjustToUpscaledCoordinates(itemEntry->celRect.bottom, itemEntry->celRect.right);
-					}
-					itemEntry->celRect.translate(itemEntry->x, itemEntry->y);
-					// TODO: maybe we should clip the cels rect with this, i'm not sure
-					//  the only currently known usage is game menu of gk1
-				} else if (view) {
-					// Process global scaling, if needed.
-					// TODO: Seems like SCI32 always processes global scaling for scaled objects
-					// TODO: We can only process symmetrical scaling for now (i.e. same value for scaleX/scaleY)
-					if ((itemEntry->scaleSignal & kScaleSignalDoScaling32) &&
-					   !(itemEntry->scaleSignal & kScaleSignalDisableGlobalScaling32) &&
-					    (itemEntry->scaleX == itemEntry->scaleY) &&
-						itemEntry->scaleX != 128)
-						applyGlobalScaling(itemEntry, it->planeRect, view->getHeight(itemEntry->loopNo, itemEntry->celNo));
-
-					if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
-						view->getCelRect(itemEntry->loopNo, itemEntry->celNo,
-							itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->celRect);
-					else
-						view->getCelScaledRect(itemEntry->loopNo, itemEntry->celNo,
-							itemEntry->x, itemEntry->y, itemEntry->z, itemEntry->scaleX,
-							itemEntry->scaleY, itemEntry->celRect);
-
-					Common::Rect nsRect = itemEntry->celRect;
-					// Translate back to actual coordinate within scrollable plane
-					nsRect.translate(it->planeOffsetX, it->planeOffsetY);
-
-					if (g_sci->getGameId() == GID_PHANTASMAGORIA2) {
-						// HACK: Some (?) objects in Phantasmagoria 2 have no NS rect. Skip them for now.
-						// TODO: Remove once we figure out how Phantasmagoria 2 draws objects on screen.
-						if (lookupSelector(_segMan, itemEntry->object, SELECTOR(nsLeft), NULL, NULL) != kSelectorVariable)
-							continue;
-					}
-
-					if (view && view->isSci2Hires()) {
-						view->adjustBackUpscaledCoordinates(nsRect.top, nsRect.left);
-						view->adjustBackUpscaledCoordinates(nsRect.bottom, nsRect.right);
-						g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
-					} else if (getSciVersion() >= SCI_VERSION_2_1_EARLY && _resMan->detectHires()) {
-						_coordAdjuster->fromDisplayToScript(nsRect.top, nsRect.left);
-						_coordAdjuster->fromDisplayToScript(nsRect.bottom, nsRect.right);
-						g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
-					}
-
-					// TODO: For some reason, the top left nsRect coordinates get
-					// swapped in the GK1 inventory screen, investigate why.
-					// This is also needed for GK1 rooms 710 and 720 (catacombs, inner and
-					// outer circle), for handling the tiles and talking to Wolfgang.
-					// HACK: Fix the coordinates by explicitly setting them here for GK1.
-					// Also check bug #6729, for another case where this is needed.
-					if (g_sci->getGameId() == GID_GK1)
-						g_sci->_gfxCompare->setNSRect(itemEntry->object, nsRect);
-				}
+	// Items drawn in upscaled hires mode and remapped colors do not map to
+	// screen areas in a simple way, so the whole screen is updated then.
+	bool fullUpdate = _forceFullUpdate ||
+	                  _screen->getUpscaledHires() != GFX_SCREEN_UPSCALED_DISABLED ||
+	                  _palette->isRemapActive() ||
+	                  _showScrollText != _lastShowScrollText ||
+	                  _curScrollText != _lastScrollText;
 
-				// Don't attempt to draw sprites that are outside the visible
-				// screen area. An example is the random people walking in
-				// Jackson Square in GK1.
-				if (itemEntry->celRect.bottom < 0 || itemEntry->celRect.top  >= _screen->getDisplayHeight() ||
-				    itemEntry->celRect.right  < 0 || itemEntry->celRect.left >= _screen->getDisplayWidth())
-					continue;
-
-				Common::Rect clipRect, translatedClipRect;
-				clipRect = itemEntry->celRect;
-
-				if (view && view->isSci2Hires()) {
-					clipRect.clip(it->upscaledPlaneClipRect);
-					translatedClipRect = clipRect;
-					translatedClipRect.translate(it->upscaledPlaneRect.left, it->upscaledPlaneRect.top);
-				} else {
-					// QFG4 passes invalid rectangles when a battle is starting
-					if (!clipRect.isValidRect())
-						continue;
-					clipRect.clip(it->planeClipRect);
-					translatedClipRect = clipRect;
-					translatedClipRect.translate(it->planeRect.left, it->planeRect.top);
-				}
+	Common::Array<Common::Rect> dirtyRects;
+	if (!fullUpdate)
+		findChangedRects(drawList, dirtyRects);
 
-				if (view) {
-					if (!clipRect.isEmpty()) {
-						if ((itemEntry->scaleX == 128) && (itemEntry->scaleY == 128))
-							view->draw(itemEntry->celRect, clipRect, translatedClipRect,
-								itemEntry->loopNo, itemEntry->celNo, 255, 0, view->isSci2Hires());
-						else
-							view->drawScaled(itemEntry->celRect, clipRect, translatedClipRect,
-								itemEntry->loopNo, itemEntry->celNo, 255, itemEntry->scaleX, itemEntry->scaleY);
-					}
-				}
+	_stats.frames++;
+	_stats.lastItemsDrawn = 0;
 
-				// Draw text, if it exists
-				if (lookupSelector(_segMan, itemEntry->object, SELECTOR(text), NULL, NULL) == kSelectorVariable) {
-					g_sci->_gfxText32->drawTextBitmap(itemEntry->x, itemEntry->y, it->planeRect, itemEntry->object);
-				}
-			}
-		}
+	if (fullUpdate || !dirtyRects.empty()) {
+		for (uint i = 0; i < drawList.size(); i++)
+			drawPlane(drawList[i]);
 
-		for (PlanePictureList::iterator pictureIt = _planePictures.begin(); pictureIt != _planePictures.end(); pictureIt++) {
-			if (pictureIt->object == planeObject) {
-				delete[] pictureIt->pictureCels;
-				pictureIt->pictureCels = 0;
-			}
-		}
+		showCurrentScrollText();
+
+		updateScreen(dirtyRects, fullUpdate);
+	} else {
+		_stats.framesSkipped++;
+		_stats.lastPixelsTouched = 0;
+		_stats.lastDirtyRects = 0;
 	}
 
-	showCurrentScrollText();
+	for (PlanePictureList::iterator pictureIt = _planePictures.begin(); pictureIt != _planePictures.end(); pictureIt++) {
+		delete[] pictureIt->pictureCels;
+		pictureIt->pictureCels = 0;
+	}
 
-	_screen->copyToScreen();
+	_lastDrawList = drawList;
+	_lastShowScrollText = _showScrollText;
+	_lastScrollText = _curScrollText;
+	_forceFullUpdate = false;
 
 	g_sci->getEngineState()->_throttleTrigger = true;
 }
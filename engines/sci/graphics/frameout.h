@@ -97,6 +97,78 @@ struct ScrollTextEntry {
 
 typedef Common::Array<ScrollTextEntry> ScrollTextList;
 
+/**
+ * A screen item or picture cel drawn by kernelFrameout(), along with the
+ * state it was drawn with. The states of consecutive frames are compared to
+ * find the parts of the screen which changed.
+ */
+struct FrameoutDrawItem {
+	FrameoutEntry *entry; // only valid while the frame is drawn
+	Common::Rect clipRect;
+	Common::Rect translatedClipRect;
+	bool hasText;
+	Common::Rect textRect;
+
+	reg_t object; // NULL_REG for picture cels, which are covered by the plane state
+	int16 x, y;
+	Common::Rect celRect;
+	GuiResourceId viewId;
+	int16 loopNo;
+	int16 celNo;
+	int16 scaleX;
+	int16 scaleY;
+	int16 priority;
+	uint32 textChecksum;
+
+	bool sameState(const FrameoutDrawItem &other) const;
+};
+
+/**
+ * The state a plane was drawn with by kernelFrameout().
+ */
+struct FrameoutDrawPlane {
+	PlaneEntry *entry; // only valid while the frame is drawn
+	bool clearRect;    // plane was hidden, its area has to be cleared
+
+	reg_t object;
+	bool visible;
+	int16 planeOffsetX;
+	int16 planeOffsetY;
+	GuiResourceId pictureId;
+	Common::Rect planeRect;
+	Common::Rect planeClipRect;
+	bool planePictureMirrored;
+	byte planeBack;
+
+	Common::Array<FrameoutDrawItem> items;
+
+	bool sameState(const FrameoutDrawPlane &other) const;
+};
+
+typedef Common::Array<FrameoutDrawPlane> FrameoutDrawList;
+
+/**
+ * Statistics about the screen updates done by kernelFrameout().
+ */
+struct FrameoutStats {
+	uint32 frames;          ///< kFrameout calls
+	uint32 framesSkipped;   ///< calls in which nothing changed
+	uint32 fullUpdates;     ///< calls which updated the whole screen
+	uint32 itemsDrawn;      ///< screen items and picture cels drawn
+	uint32 pixelsTouched;   ///< pixels passed on to the backend
+
+	uint32 lastItemsDrawn;
+	uint32 lastPixelsTouched;
+	uint32 lastDirtyRects;
+
+	FrameoutStats() { reset(); }
+
+	void reset() {
+		frames = framesSkipped = fullUpdates = itemsDrawn = pixelsTouched = 0;
+		lastItemsDrawn = lastPixelsTouched = lastDirtyRects = 0;
+	}
+};
+
 enum ViewScaleSignals32 {
 	kScaleSignalDoScaling32				= 0x0001, // enables scaling when drawing that cel (involves scaleX and scaleY)
 	kScaleSignalUnk1					= 0x0002, // unknown
@@ -151,11 +223,28 @@ public:
 	void printPlaneList(Console *con);
 	void printPlaneItemList(Console *con, reg_t planeObject);
 
+	/**
+	 * Make the next kFrameout call redraw and update the whole screen.
+	 * Needed when something else drew over the game screen, e.g. a video.
+	 */
+	void forceFullUpdate() { _forceFullUpdate = true; }
+
+	FrameoutStats &getStats() { return _stats; }
+
 private:
 	void showVideo();
 	void createPlaneItemList(reg_t planeObject, FrameoutList &itemList);
 	bool isPictureOutOfView(FrameoutEntry *itemEntry, Common::Rect planeRect, int16 planeOffsetX, int16 planeOffsetY);
 	void drawPicture(FrameoutEntry *itemEntry, int16 planeOffsetX, int16 planeOffsetY, bool planePictureMirrored);
+	void prepareScreenItem(PlaneEntry &plane, FrameoutEntry *itemEntry, FrameoutDrawPlane &drawPlane);
+	void drawPlane(const FrameoutDrawPlane &drawPlane);
+
+	/**
+	 * Find the parts of the screen which differ between the previous and
+	 * the given frame.
+	 */
+	void findChangedRects(const FrameoutDrawList &drawList, Common::Array<Common::Rect> &dirtyRects);
+	void updateScreen(const Common::Array<Common::Rect> &dirtyRects, bool fullUpdate);
 
 	SegManager *_segMan;
 	ResourceManager *_resMan;
@@ -173,6 +262,14 @@ private:
 	bool _showScrollText;
 	uint16 _maxScrollTexts;
 
+	// State of the previously drawn frame
+	FrameoutDrawList _lastDrawList;
+	bool _lastShowScrollText;
+	int16 _lastScrollText;
+	bool _forceFullUpdate;
+
+	FrameoutStats _stats;
+
 	void sortPlanes();
 };
 
@@ -68,6 +68,7 @@ public:
 	void setRemappingPercent(byte color, byte percent);
 	void setRemappingPercentGray(byte color, byte percent);
 	void setRemappingRange(byte color, byte from, byte to, byte base);
+	bool isRemapActive() const { return _remapOn; }
 	bool isRemapped(byte color) const {
 		return _remapOn && (_remappingType[color] != kRemappingNone);
 	}
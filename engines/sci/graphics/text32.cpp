@@ -43,7 +43,7 @@ namespace Sci {
 #define SCI_TEXT32_ALIGNMENT_LEFT	0
 
 GfxText32::GfxText32(SegManager *segMan, GfxCache *fonts, GfxScreen *screen)
-	: _segMan(segMan), _cache(fonts), _screen(screen) {
+	: _segMan(segMan), _cache(fonts), _screen(screen), _lastBitmapVersion(0) {
 }
 
 GfxText32::~GfxText32() {
@@ -108,6 +108,7 @@ reg_t GfxText32::createTextBitmapInternal(Common::String &text, reg_t textObject
 		memoryId = prevHunk;
 	}
 	byte *memoryPtr = _segMan->getHunkPointer(memoryId);
+	textBitmapChanged(memoryId);
 
 	if (prevHunk.isNull())
 		memset(memoryPtr, 0, BITMAP_HEADER_SIZE);
@@ -195,7 +196,12 @@ reg_t GfxText32::createTextBitmapInternal(Common::String &text, reg_t textObject
 	return memoryId;
 }
 
+void GfxText32::textBitmapChanged(reg_t hunkId) {
+	_bitmapVersions[hunkId] = ++_lastBitmapVersion;
+}
+
 void GfxText32::disposeTextBitmap(reg_t hunkId) {
+	_bitmapVersions.erase(hunkId);
 	_segMan->freeHunkEntry(hunkId);
 }
 
@@ -218,6 +224,45 @@ void GfxText32::drawScrollTextBitmap(reg_t textObject, reg_t hunkId, uint16 x, u
 	drawTextBitmapInternal(0, 0, Common::Rect(20, 390, 600, 460), textObject, hunkId);
 }
 
+uint32 GfxText32::getTextBitmapChecksum(reg_t textObject) {
+	uint32 checksum = (uint16)readSelectorValue(_segMan, textObject, SELECTOR(back));
+	checksum = checksum * 31 + (uint16)readSelectorValue(_segMan, textObject, SELECTOR(skip));
+
+	reg_t hunkId = readSelector(_segMan, textObject, SELECTOR(bitmap));
+	checksum = checksum * 31 + hunkId.getSegment();
+	checksum = checksum * 31 + hunkId.getOffset();
+	checksum = checksum * 31 + _bitmapVersions.getVal(hunkId, 0);
+
+	return checksum;
+}
+
+Common::Rect GfxText32::getTextBitmapRect(int16 x, int16 y, const Common::Rect &planeRect, reg_t textObject) {
+	// This follows the checks and coordinates of drawTextBitmapInternal()
+	reg_t hunkId = readSelector(_segMan, textObject, SELECTOR(bitmap));
+	if (hunkId.isNull() || x < 0 || y < 0)
+		return Common::Rect();
+
+	const byte *memoryPtr = _segMan->getHunkPointer(hunkId);
+	if (!memoryPtr)
+		return Common::Rect();
+
+	uint16 textX = planeRect.left + x;
+	uint16 textY = planeRect.top + y;
+	uint16 width = READ_LE_UINT16(memoryPtr);
+	uint16 height = READ_LE_UINT16(memoryPtr + 2);
+
+	if (_screen->fontIsUpscaled()) {
+		textX = textX * _screen->getDisplayWidth() / _screen->getWidth();
+		textY = textY * _screen->getDisplayHeight() / _screen->getHeight();
+	} else if (_screen->getUpscaledHires() != GFX_SCREEN_UPSCALED_DISABLED) {
+		// The pixels are doubled on the display, through a height mapping
+		// which isn't linear. Play safe and use the whole plane.
+		return planeRect;
+	}
+
+	return Common::Rect(textX, textY, textX + width, textY + height);
+}
+
 void GfxText32::drawTextBitmapInternal(int16 x, int16 y, Common::Rect planeRect, reg_t textObject, reg_t hunkId) {
 	int16 backColor = (int16)readSelectorValue(_segMan, textObject, SELECTOR(back));
 	// Sanity check: Check if the hunk is set. If not, either the game scripts
@@ -23,6 +23,11 @@
 #ifndef SCI_GRAPHICS_TEXT32_H
 #define SCI_GRAPHICS_TEXT32_H
 
+#include "common/hashmap.h"
+#include "common/rect.h"
+
+#include "sci/engine/gc.h"
+
 namespace Sci {
 
 /**
@@ -36,6 +41,26 @@ public:
 	reg_t createScrollTextBitmap(Common::String text, reg_t textObject, uint16 maxWidth = 0, uint16 maxHeight = 0, reg_t prevHunk = NULL_REG);
 	void drawTextBitmap(int16 x, int16 y, Common::Rect planeRect, reg_t textObject);
 	void drawScrollTextBitmap(reg_t textObject, reg_t hunkId, uint16 x, uint16 y);
+
+	/**
+	 * Calculate a checksum of the state drawTextBitmap() draws a text object
+	 * with, to find out whether the text changed since it was last drawn.
+	 * The bitmap contents are represented by their version, see
+	 * textBitmapChanged().
+	 */
+	uint32 getTextBitmapChecksum(reg_t textObject);
+
+	/**
+	 * Return the screen area drawTextBitmap() draws to, or an empty rect if
+	 * it draws nothing.
+	 */
+	Common::Rect getTextBitmapRect(int16 x, int16 y, const Common::Rect &planeRect, reg_t textObject);
+
+	/**
+	 * Give a bitmap a new version. This has to be called whenever the kernel
+	 * writes to a bitmap.
+	 */
+	void textBitmapChanged(reg_t hunkId);
 	void disposeTextBitmap(reg_t hunkId);
 	int16 GetLongest(const char *text, int16 maxWidth, GfxFont *font);
 
@@ -51,6 +76,11 @@ private:
 	SegManager *_segMan;
 	GfxCache *_cache;
 	GfxScreen *_screen;
+
+	// The version of each bitmap, which changes with every write to it
+	typedef Common::HashMap<reg_t, uint32, reg_t_Hash> BitmapVersionMap;
+	BitmapVersionMap _bitmapVersions;
+	uint32 _lastBitmapVersion;
 };
 
 } // End of namespace Sci
@@ -26,6 +26,7 @@
 #include "sci/graphics/screen.h"
 #include "sci/graphics/palette.h"
 #include "sci/graphics/coordadjuster.h"
+#include "sci/graphics/celscale.h"
 #include "sci/graphics/view.h"
 
 namespace Sci {
@@ -48,6 +49,9 @@ GfxView::~GfxView() {
 	}
 	delete[] _loop;
 
+	for (ScaledCelList::iterator it = _scaledCels.begin(); it != _scaledCels.end(); ++it)
+		delete[] it->bitmap;
+
 	_resMan->unlockResource(_resource);
 }
 
@@ -112,6 +116,8 @@ void GfxView::initData(GuiResourceId resourceId) {
 	}
 	_resourceData = _resource->data;
 	_resourceSize = _resource->size;
+	_bitmapSize = 0;
+	_scaledCelSize = 0;
 
 	byte *celData, *loopData;
 	uint16 celOffset;
@@ -692,6 +698,13 @@ void GfxView::unpackCel(int16 loopNo, int16 celNo, byte *outPtr, uint32 pixelCou
 	}
 }
 
+uint32 GfxView::getMemoryUsage() const {
+	uint32 size = _resourceSize + _bitmapSize + _scaledCelSize + _loopCount * sizeof(LoopInfo);
+	for (uint16 loopNum = 0; loopNum < _loopCount; loopNum++)
+		size += _loop[loopNum].celCount * sizeof(CelInfo);
+	return size;
+}
+
 const byte *GfxView::getBitmap(int16 loopNo, int16 celNo) {
 	loopNo = CLIP<int16>(loopNo, 0, _loopCount -1);
 	celNo = CLIP<int16>(celNo, 0, _loop[loopNo].celCount - 1);
@@ -703,6 +716,7 @@ const byte *GfxView::getBitmap(int16 loopNo, int16 celNo) {
 	// allocating memory to store cel's bitmap
 	int pixelCount = width * height;
 	_loop[loopNo].cel[celNo].rawBitmap = new byte[pixelCount];
+	_bitmapSize += pixelCount;
 	byte *pBitmap = _loop[loopNo].cel[celNo].rawBitmap;
 
 	// unpack the actual cel bitmap data
@@ -888,73 +902,59 @@ void GfxView::draw(const Common::Rect &rect, const Common::Rect &clipRect, const
 	}
 }
 
-/**
- * We don't fully follow sierra sci here, I did the scaling algo myself and it
- * is definitely not pixel-perfect with the one sierra is using. It shouldn't
- * matter because the scaled cel rect is definitely the same as in sierra sci.
- */
+const ScaledCelInfo &GfxView::getScaledBitmap(int16 loopNo, int16 celNo, int16 scaleX, int16 scaleY) {
+	for (ScaledCelList::iterator it = _scaledCels.begin(); it != _scaledCels.end(); ++it) {
+		if (it->loopNo == loopNo && it->celNo == celNo && it->scaleX == scaleX && it->scaleY == scaleY) {
+			// Move to the front, so that the least recently used cels are
+			// at the end of the list
+			if (it != _scaledCels.begin()) {
+				_scaledCels.push_front(*it);
+				_scaledCels.erase(it);
+			}
+			return _scaledCels.front();
+		}
+	}
+
+	if (_scaledCels.size() >= MAX_CACHED_SCALED_CELS) {
+		const ScaledCelInfo &oldest = _scaledCels.back();
+		_scaledCelSize -= oldest.width * oldest.height;
+		delete[] oldest.bitmap;
+		_scaledCels.pop_back();
+	}
+
+	const CelInfo *celInfo = getCelInfo(loopNo, celNo);
+	int16 scaledWidth = (celInfo->width * scaleX) >> 7;
+	int16 scaledHeight = (celInfo->height * scaleY) >> 7;
+	scaledWidth = CLIP<int16>(scaledWidth, 0, _screen->getWidth());
+	scaledHeight = CLIP<int16>(scaledHeight, 0, _screen->getHeight());
+
+	ScaledCelInfo scaledCel;
+	scaledCel.loopNo = loopNo;
+	scaledCel.celNo = celNo;
+	scaledCel.scaleX = scaleX;
+	scaledCel.scaleY = scaleY;
+	scaledCel.width = scaledWidth;
+	scaledCel.height = scaledHeight;
+	scaledCel.bitmap = new byte[scaledWidth * scaledHeight];
+	scaleCelBitmap(scaledCel.bitmap, scaledWidth, scaledHeight, getBitmap(loopNo, celNo), celInfo->width, celInfo->height, scaleX, scaleY);
+
+	_scaledCelSize += scaledWidth * scaledHeight;
+	_scaledCels.push_front(scaledCel);
+	return _scaledCels.front();
+}
+
 void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect, const Common::Rect &clipRectTranslated,
 			int16 loopNo, int16 celNo, byte priority, int16 scaleX, int16 scaleY) {
 	const Palette *palette = _embeddedPal ? &_viewPalette : &_palette->_sysPalette;
 	const CelInfo *celInfo = getCelInfo(loopNo, celNo);
-	const byte *bitmap = getBitmap(loopNo, celNo);
-	const int16 celHeight = celInfo->height;
-	const int16 celWidth = celInfo->width;
+	const ScaledCelInfo &scaledCel = getScaledBitmap(loopNo, celNo, scaleX, scaleY);
 	const byte clearKey = celInfo->clearKey;
 	const byte drawMask = priority > 15 ? GFX_SCREEN_MASK_VISUAL : GFX_SCREEN_MASK_VISUAL|GFX_SCREEN_MASK_PRIORITY;
-	uint16 scalingX[640];
-	uint16 scalingY[480];
-	int16 scaledWidth, scaledHeight;
-	int pixelNo, scaledPixel, scaledPixelNo, prevScaledPixelNo;
 
 	if (_embeddedPal)
 		// Merge view palette in...
 		_palette->set(&_viewPalette, false);
 
-	scaledWidth = (celInfo->width * scaleX) >> 7;
-	scaledHeight = (celInfo->height * scaleY) >> 7;
-	scaledWidth = CLIP<int16>(scaledWidth, 0, _screen->getWidth());
-	scaledHeight = CLIP<int16>(scaledHeight, 0, _screen->getHeight());
-
-	// Do we really need to do this?!
-	//memset(scalingX, 0, sizeof(scalingX));
-	//memset(scalingY, 0, sizeof(scalingY));
-
-	// Create height scaling table
-	pixelNo = 0;
-	scaledPixel = scaledPixelNo = prevScaledPixelNo = 0;
-	while (pixelNo < celHeight) {
-		scaledPixelNo = scaledPixel >> 7;
-		assert(scaledPixelNo < ARRAYSIZE(scalingY));
-		for (; prevScaledPixelNo <= scaledPixelNo; prevScaledPixelNo++)
-			scalingY[prevScaledPixelNo] = pixelNo;
-		pixelNo++;
-		scaledPixel += scaleY;
-	}
-	pixelNo--;
-	scaledPixelNo++;
-	for (; scaledPixelNo < scaledHeight; scaledPixelNo++)
-		scalingY[scaledPixelNo] = pixelNo;
-
-	// Create width scaling table
-	pixelNo = 0;
-	scaledPixel = scaledPixelNo = prevScaledPixelNo = 0;
-	while (pixelNo < celWidth) {
-		scaledPixelNo = scaledPixel >> 7;
-		assert(scaledPixelNo < ARRAYSIZE(scalingX));
-		for (; prevScaledPixelNo <= scaledPixelNo; prevScaledPixelNo++)
-			scalingX[prevScaledPixelNo] = pixelNo;
-		pixelNo++;
-		scaledPixel += scaleX;
-	}
-	pixelNo--;
-	scaledPixelNo++;
-	for (; scaledPixelNo < scaledWidth; scaledPixelNo++)
-		scalingX[scaledPixelNo] = pixelNo;
-
-	scaledWidth = MIN(clipRect.width(), scaledWidth);
-	scaledHeight = MIN(clipRect.height(), scaledHeight);
-
 	const int16 offsetY = clipRect.top - rect.top;
 	const int16 offsetX = clipRect.left - rect.left;
 
@@ -962,11 +962,13 @@ void GfxView::drawScaled(const Common::Rect &rect, const Common::Rect &clipRect,
 	if (offsetX < 0 || offsetY < 0)
 		return;
 
-	assert(scaledHeight + offsetY <= ARRAYSIZE(scalingY));
-	assert(scaledWidth + offsetX <= ARRAYSIZE(scalingX));
+	const int16 scaledWidth = MIN<int16>(clipRect.width(), scaledCel.width - offsetX);
+	const int16 scaledHeight = MIN<int16>(clipRect.height(), scaledCel.height - offsetY);
+
 	for (int y = 0; y < scaledHeight; y++) {
+		const byte *bitmap = scaledCel.bitmap + (y + offsetY) * scaledCel.width + offsetX;
 		for (int x = 0; x < scaledWidth; x++) {
-			const byte color = bitmap[scalingY[y + offsetY] * celWidth + scalingX[x + offsetX]];
+			const byte color = bitmap[x];
 			const int x2 = clipRectTranslated.left + x;
 			const int y2 = clipRectTranslated.top + y;
 			if (color != clearKey && priority >= _screen->getPriority(x2, y2)) {
@@ -23,6 +23,8 @@
 #ifndef SCI_GRAPHICS_VIEW_H
 #define SCI_GRAPHICS_VIEW_H
 
+#include "common/list.h"
+
 namespace Sci {
 
 enum Sci32ViewNativeResolution {
@@ -44,6 +46,19 @@ struct CelInfo {
 	byte *rawBitmap;
 };
 
+/**
+ * A cel bitmap scaled by drawScaled(). Mirrored loops are already mirrored in
+ * the unscaled bitmap, so they need no separate entries.
+ */
+struct ScaledCelInfo {
+	int16 loopNo, celNo;
+	int16 scaleX, scaleY;
+	int16 width, height;
+	byte *bitmap;
+};
+
+typedef Common::List<ScaledCelInfo> ScaledCelList;
+
 struct LoopInfo {
 	bool mirrorFlag;
 	uint16 celCount;
@@ -87,11 +102,24 @@ public:
 
 	byte getColorAtCoordinate(int16 loopNo, int16 celNo, int16 x, int16 y);
 
+	/**
+	 * Returns the number of bytes held by this view, i.e. its resource and
+	 * all cels unpacked so far.
+	 */
+	uint32 getMemoryUsage() const;
+
 private:
 	void initData(GuiResourceId resourceId);
 	void unpackCel(int16 loopNo, int16 celNo, byte *outPtr, uint32 pixelCount);
 	void unditherBitmap(byte *bitmap, int16 width, int16 height, byte clearKey);
 
+	/**
+	 * Returns the given cel scaled to the given size. The last
+	 * MAX_CACHED_SCALED_CELS scaled cels are kept, as actors are usually
+	 * drawn at the same scale for many frames.
+	 */
+	const ScaledCelInfo &getScaledBitmap(int16 loopNo, int16 celNo, int16 scaleX, int16 scaleY);
+
 	ResourceManager *_resMan;
 	GfxCoordAdjuster *_coordAdjuster;
 	GfxScreen *_screen;
@@ -101,6 +129,10 @@ private:
 	Resource *_resource;
 	byte *_resourceData;
 	int _resourceSize;
+	uint32 _bitmapSize;
+
+	ScaledCelList _scaledCels;
+	uint32 _scaledCelSize;
 
 	uint16 _loopCount;
 	LoopInfo *_loop;
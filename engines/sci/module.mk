@@ -43,6 +43,7 @@ MODULE_OBJS := \
 	engine/workarounds.o \
 	graphics/animate.o \
 	graphics/cache.o \
+	graphics/celscale.o \
 	graphics/compare.o \
 	graphics/controls16.o \
 	graphics/coordadjuster.o \
@@ -22,9 +22,12 @@
 
 // Resource library
 
+#include "common/algorithm.h"
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 #include "sci/resource.h"
@@ -770,7 +773,7 @@ void ExtAudioMapResourceSource::scanSource(ResourceManager *resMan) {
 }
 
 void IntMapResourceSource::scanSource(ResourceManager *resMan) {
-	resMan->readAudioMapSCI11(this);
+	resMan->scanAudioMapSCI11(this);
 }
 
 #ifdef ENABLE_SCI32
@@ -861,7 +864,7 @@ void ResourceManager::freeResourceSources() {
 	_sources.clear();
 }
 
-ResourceManager::ResourceManager() {
+ResourceManager::ResourceManager() : _recordingAudioMap(0) {
 }
 
 void ResourceManager::init() {
@@ -871,6 +874,8 @@ void ResourceManager::init() {
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
 
+	uint32 startTime = g_system->getMillis();
+
 	// FIXME: put this in an Init() function, so that we can error out if detection fails completely
 
 	_mapVersion = detectMapVersion();
@@ -901,8 +906,19 @@ void ResourceManager::init() {
 		return;
 	}
 
+	uint32 versionTime = g_system->getMillis();
+
 	scanNewSources();
 
+	uint32 mapTime = g_system->getMillis();
+
+	_audioMapIndexName = ConfMan.getActiveDomainName();
+	if (!_audioMapIndexName.empty()) {
+		_audioMapIndexName += ".residx";
+		loadAudioMapIndex();
+	}
+	_audioMapsIndexed = _audioMapsRead = 0;
+
 	if (!addAudioSources()) {
 		// FIXME: This error message is not always correct.
 		// OTOH, it is nice to be able to detect missing files/sources
@@ -914,9 +930,23 @@ void ResourceManager::init() {
 	addScriptChunkSources();
 	scanNewSources();
 
+	if (!_audioMapIndexName.empty()) {
+		saveAudioMapIndex();
+		_audioMapIndex.clear();
+		_indexedFileSizes.clear();
+		_audioMapIndexName.clear();
+	}
+
+	uint32 audioTime = g_system->getMillis();
+
 	detectSciVersion();
 
+	uint32 endTime = g_system->getMillis();
+
 	debugC(1, kDebugLevelResMan, "resMan: Detected %s", getSciVersionDesc(getSciVersion()));
+	debugC(1, kDebugLevelResMan, "resMan: Startup took %u ms: versions %u ms, maps and patches %u ms, audio and chunks %u ms (%u audio maps indexed, %u read), game version %u ms",
+	       endTime - startTime, versionTime - startTime, mapTime - versionTime, audioTime - mapTime,
+	       _audioMapsIndexed, _audioMapsRead, endTime - audioTime);
 
 	switch (_viewType) {
 	case kViewEga:
@@ -1047,7 +1077,71 @@ Common::List<ResourceId> ResourceManager::listResources(ResourceType type, int m
 	return resources;
 }
 
+void ResourceManager::preloadResource(ResourceId id) {
+	_preloadQueue[id] = true;
+}
+
+void ResourceManager::loadPreloadQueue() {
+	// Clear the queue first, loading might look up other resources
+	Common::Array<ResourceId> ids;
+	for (PreloadQueue::const_iterator it = _preloadQueue.begin(); it != _preloadQueue.end(); ++it)
+		ids.push_back(it->_key);
+	_preloadQueue.clear();
+
+	_preloadStats.batches++;
+	_preloadStats.queued += ids.size();
+	_preloadStats.largestBatch = MAX<uint32>(_preloadStats.largestBatch, ids.size());
+	_preloadStats.loaded += loadResources(ids);
+}
+
+bool ResourceManager::isBeforeInFile(const Resource *a, const Resource *b) {
+	if (a->_source != b->_source)
+		return a->_source < b->_source;
+	return a->_fileOffset < b->_fileOffset;
+}
+
+uint ResourceManager::loadResources(const Common::Array<ResourceId> &ids) {
+	Common::Array<Resource *> resources;
+	uint loaded = 0;
+
+	for (uint i = 0; i < ids.size(); i++) {
+		Resource *res = testResource(ids[i]);
+		if (res && res->_status == kResStatusNoMalloc)
+			resources.push_back(res);
+	}
+
+	// Read each resource file from front to back
+	Common::sort(resources.begin(), resources.end(), isBeforeInFile);
+
+	for (uint i = 0; i < resources.size() && _memoryLRU < MAX_MEMORY; i++) {
+		Resource *res = resources[i];
+		// Might have been loaded as a side effect of an earlier one
+		if (res->_status != kResStatusNoMalloc)
+			continue;
+
+		loadResource(res);
+		if (res->_status == kResStatusAllocated) {
+			addToLRU(res);
+			loaded++;
+		}
+	}
+
+	freeOldResources();
+	return loaded;
+}
+
+void ResourceManager::resetDecompressorStats() {
+	for (int i = 0; i <= kCompDCL; i++)
+		_decompressorStats[i].reset();
+	_preloadStats.reset();
+}
+
 Resource *ResourceManager::findResource(ResourceId id, bool lock) {
+	// Lookups of other resources, like the scripts of a new room, leave the
+	// queue alone, so that it collects everything the room announces
+	if (_preloadQueue.contains(id))
+		loadPreloadQueue();
+
 	Resource *retval = testResource(id);
 
 	if (!retval)
@@ -1838,6 +1932,14 @@ void ResourceManager::addResource(ResourceId resId, ResourceSource *src, uint32
 		res->_fileOffset = offset;
 		res->size = size;
 	}
+
+	if (_recordingAudioMap) {
+		IndexedAudioMapEntry entry;
+		entry.id = resId;
+		entry.offset = offset;
+		entry.size = size;
+		_recordingAudioMap->entries.push_back(entry);
+	}
 }
 
 Resource *ResourceManager::updateResource(ResourceId resId, ResourceSource *src, uint32 size) {
@@ -2000,9 +2102,18 @@ int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file
 
 	data = new byte[size];
 	_status = kResStatusAllocated;
+
+	const uint32 startTime = g_system->getMillis();
 	errorNum = data ? dec->unpack(file, data, szPacked, size) : SCI_ERROR_RESOURCE_TOO_BIG;
-	if (errorNum)
+	if (errorNum) {
 		unalloc();
+	} else {
+		DecompressorStats &stats = _resMan->getDecompressorStats(compression);
+		stats.resources++;
+		stats.packedBytes += szPacked;
+		stats.unpackedBytes += size;
+		stats.time += g_system->getMillis() - startTime;
+	}
 
 	delete dec;
 	return errorNum;
@@ -23,6 +23,7 @@
 #ifndef SCI_RESOURCE_H
 #define SCI_RESOURCE_H
 
+#include "common/array.h"
 #include "common/str.h"
 #include "common/list.h"
 #include "common/hashmap.h"
@@ -285,6 +286,52 @@ protected:
 
 typedef Common::HashMap<ResourceId, Resource *, ResourceIdHash> ResourceMap;
 
+/**
+ * Statistics about the batches of resources queued by preloadResource().
+ */
+struct PreloadStats {
+	uint32 batches;
+	uint32 queued;       ///< resources queued by all batches
+	uint32 loaded;       ///< resources read, the others were loaded already
+	uint32 largestBatch; ///< most resources queued by one batch
+
+	PreloadStats() { reset(); }
+
+	void reset() {
+		batches = queued = loaded = largestBatch = 0;
+	}
+};
+
+struct IndexedAudioMapEntry {
+	ResourceId id;
+	uint32 offset;
+	uint32 size;
+};
+
+/**
+ * The resources of an SCI1.1 audio map, along with the files they were read
+ * from. The entries are only used while the files stay the same.
+ */
+struct IndexedAudioMap {
+	Common::String mapFile;
+	uint32 mapOffset;
+	int32 mapFileSize;
+	Common::String volumeFile;
+	int32 volumeFileSize;
+	Common::Array<IndexedAudioMapEntry> entries;
+
+	bool used; ///< Not saved, set when the map was found this time
+
+	bool sameFiles(const IndexedAudioMap &other) const {
+		return mapFile.equalsIgnoreCase(other.mapFile) && mapOffset == other.mapOffset &&
+		       mapFileSize == other.mapFileSize && volumeFile.equalsIgnoreCase(other.volumeFile) &&
+		       volumeFileSize == other.volumeFileSize;
+	}
+};
+
+typedef Common::HashMap<int, IndexedAudioMap> AudioMapIndex;
+typedef Common::HashMap<Common::String, int32, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> FileSizeMap;
+
 class ResourceManager {
 	// FIXME: These 'friend' declarations are meant to be a temporary hack to
 	// ease transition to the ResourceSource class system.
@@ -359,6 +406,30 @@ public:
 	 */
 	Resource *testResource(ResourceId id);
 
+	/**
+	 * Queues a resource to be loaded soon. Once findResource() is called
+	 * for any of the queued resources, all of them are loaded together, in
+	 * the order they are stored in, so that the resource files are read
+	 * sequentially. Scripts announce the resources of a room this way with
+	 * kLoad.
+	 * @param id	Id of the resource to load
+	 */
+	void preloadResource(ResourceId id);
+
+	/**
+	 * Loads the given resources in one go, in the order they are stored in
+	 * the resource files. Resources which are already loaded or don't exist
+	 * are skipped. The loaded resources are put under LRU control; loading
+	 * stops once the LRU memory limit is reached.
+	 * @param ids	Ids of the resources to load
+	 * @return the number of resources read
+	 */
+	uint loadResources(const Common::Array<ResourceId> &ids);
+
+	DecompressorStats &getDecompressorStats(ResourceCompression compression) { return _decompressorStats[compression]; }
+	const PreloadStats &getPreloadStats() const { return _preloadStats; }
+	void resetDecompressorStats();
+
 	/**
 	 * Returns a list of all resources of the specified type.
 	 * @param type		The resource type to look for
@@ -441,6 +512,22 @@ protected:
 	ResVersion _volVersion; ///< resource.0xx version
 	ResVersion _mapVersion; ///< resource.map version
 
+	typedef Common::HashMap<ResourceId, bool, ResourceIdHash> PreloadQueue;
+	PreloadQueue _preloadQueue; ///< Resources queued by preloadResource()
+	PreloadStats _preloadStats;
+	DecompressorStats _decompressorStats[kCompDCL + 1];
+
+	// The contents of SCI1.1 audio maps are kept in a file, as reading
+	// hundreds of map resources takes a while on CD games. It is only used
+	// while init() runs.
+	Common::String _audioMapIndexName;   ///< Savefile the index is kept in, empty when not in use
+	AudioMapIndex _audioMapIndex;
+	bool _audioMapIndexChanged;
+	IndexedAudioMap *_recordingAudioMap; ///< Map whose resources are recorded by addResource()
+	FileSizeMap _indexedFileSizes;
+	uint _audioMapsIndexed;
+	uint _audioMapsRead;
+
 	/**
 	 * Add a path to the resource manager's list of sources.
 	 * @return a pointer to the added source structure, or NULL if an error occurred.
@@ -489,6 +576,12 @@ protected:
 	Common::SeekableReadStream *getVolumeFile(ResourceSource *source);
 	void loadResource(Resource *res);
 	void freeOldResources();
+
+	/**
+	 * Orders resources by their source and offset in it.
+	 */
+	static bool isBeforeInFile(const Resource *a, const Resource *b);
+	void loadPreloadQueue();
 	void addResource(ResourceId resId, ResourceSource *src, uint32 offset, uint32 size = 0);
 	Resource *updateResource(ResourceId resId, ResourceSource *src, uint32 size);
 	void removeAudioResource(ResourceId resId);
@@ -518,6 +611,26 @@ protected:
 	 */
 	int readAudioMapSCI11(ResourceSource *map);
 
+	/**
+	 * Reads SCI1.1 audio map resources, taking their contents from the
+	 * audio map index when the files they come from did not change.
+	 * @param map The map
+	 * @return 0 on success, an SCI_ERROR_* code otherwise
+	 */
+	int scanAudioMapSCI11(ResourceSource *map);
+
+	/**--- Audio map index functions ---*/
+
+	/**
+	 * Gets the location and size of the files the given audio map and its
+	 * audio come from. Returns false if they can't be checked, in which case
+	 * the map is not indexed.
+	 */
+	bool getAudioMapFiles(ResourceSource *map, IndexedAudioMap &indexedMap);
+	int32 getIndexedFileSize(const Common::String &fileName);
+	void loadAudioMapIndex();
+	void saveAudioMapIndex();
+
 	/**
 	 * Reads SCI1 audio map files.
 	 * @param map The map
@@ -24,6 +24,8 @@
 
 #include "common/archive.h"
 #include "common/file.h"
+#include "common/savefile.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 #include "sci/resource.h"
@@ -422,6 +424,228 @@ int ResourceManager::readAudioMapSCI11(ResourceSource *map) {
 	return 0;
 }
 
+// The audio map index is kept as a savefile:
+// dw 'SCIX'
+// dw version
+// dw number of maps
+// Followed by per map:
+// w map number
+// string map file (w length, followed by the characters)
+// dw map offset
+// dw map file size
+// string volume file
+// dw volume file size
+// dw number of entries
+// Followed by 15-byte entries:
+// b type
+// w number
+// dw tuple
+// dw offset
+// dw size
+
+enum {
+	kAudioMapIndexVersion = 1,
+	kAudioMapIndexEntrySize = 15
+};
+
+static void writeIndexString(Common::WriteStream *out, const Common::String &str) {
+	out->writeUint16LE(str.size());
+	out->write(str.c_str(), str.size());
+}
+
+static bool readIndexString(Common::SeekableReadStream *in, Common::String &str) {
+	uint16 size = in->readUint16LE();
+	if (in->eos() || in->err() || size > in->size() - in->pos())
+		return false;
+
+	str.clear();
+	for (uint16 i = 0; i < size; i++)
+		str += (char)in->readByte();
+	return true;
+}
+
+void ResourceManager::loadAudioMapIndex() {
+	_audioMapIndex.clear();
+	_audioMapIndexChanged = false;
+
+	Common::InSaveFile *in = g_system->getSavefileManager()->openForLoading(_audioMapIndexName);
+	if (!in)
+		return;
+
+	bool valid = (in->readUint32BE() == MKTAG('S', 'C', 'I', 'X')) && (in->readUint32LE() == kAudioMapIndexVersion);
+	uint32 mapCount = valid ? in->readUint32LE() : 0;
+	bool damaged = in->eos() || in->err();
+
+	for (uint32 i = 0; i < mapCount && !damaged; i++) {
+		int mapNumber = in->readUint16LE();
+		IndexedAudioMap &indexedMap = _audioMapIndex[mapNumber];
+		if (!readIndexString(in, indexedMap.mapFile)) {
+			damaged = true;
+			break;
+		}
+		indexedMap.mapOffset = in->readUint32LE();
+		indexedMap.mapFileSize = in->readSint32LE();
+		if (!readIndexString(in, indexedMap.volumeFile)) {
+			damaged = true;
+			break;
+		}
+		indexedMap.volumeFileSize = in->readSint32LE();
+		indexedMap.used = false;
+
+		// The entries have to fit into the rest of the file, this is checked
+		// before allocating them
+		uint32 entryCount = in->readUint32LE();
+		if (in->eos() || in->err() || entryCount > (uint32)(in->size() - in->pos()) / kAudioMapIndexEntrySize) {
+			damaged = true;
+			break;
+		}
+
+		indexedMap.entries.resize(entryCount);
+		for (uint32 j = 0; j < entryCount; j++) {
+			IndexedAudioMapEntry &entry = indexedMap.entries[j];
+			byte type = in->readByte();
+			uint16 number = in->readUint16LE();
+			uint32 tuple = in->readUint32LE();
+			entry.offset = in->readUint32LE();
+			entry.size = in->readUint32LE();
+			if (in->eos() || in->err() || type >= kResourceTypeInvalid) {
+				damaged = true;
+				break;
+			}
+			entry.id = ResourceId((ResourceType)type, number, tuple);
+		}
+	}
+
+	if (damaged) {
+		warning("Ignoring damaged resource index %s", _audioMapIndexName.c_str());
+		_audioMapIndex.clear();
+		_audioMapIndexChanged = true;
+	}
+
+	delete in;
+}
+
+void ResourceManager::saveAudioMapIndex() {
+	uint32 mapCount = 0;
+	for (AudioMapIndex::const_iterator it = _audioMapIndex.begin(); it != _audioMapIndex.end(); ++it) {
+		if (it->_value.used)
+			mapCount++;
+	}
+
+	// Maps which weren't found this time are dropped from the index
+	if (!_audioMapIndexChanged && mapCount == _audioMapIndex.size())
+		return;
+
+	Common::OutSaveFile *out = g_system->getSavefileManager()->openForSaving(_audioMapIndexName);
+	if (!out) {
+		warning("Could not write resource index %s", _audioMapIndexName.c_str());
+		return;
+	}
+
+	out->writeUint32BE(MKTAG('S', 'C', 'I', 'X'));
+	out->writeUint32LE(kAudioMapIndexVersion);
+	out->writeUint32LE(mapCount);
+
+	for (AudioMapIndex::const_iterator it = _audioMapIndex.begin(); it != _audioMapIndex.end(); ++it) {
+		const IndexedAudioMap &indexedMap = it->_value;
+		if (!indexedMap.used)
+			continue;
+
+		out->writeUint16LE(it->_key);
+		writeIndexString(out, indexedMap.mapFile);
+		out->writeUint32LE(indexedMap.mapOffset);
+		out->writeSint32LE(indexedMap.mapFileSize);
+		writeIndexString(out, indexedMap.volumeFile);
+		out->writeSint32LE(indexedMap.volumeFileSize);
+
+		out->writeUint32LE(indexedMap.entries.size());
+		for (uint32 i = 0; i < indexedMap.entries.size(); i++) {
+			const IndexedAudioMapEntry &entry = indexedMap.entries[i];
+			out->writeByte(entry.id.getType());
+			out->writeUint16LE(entry.id.getNumber());
+			out->writeUint32LE(entry.id.getTuple());
+			out->writeUint32LE(entry.offset);
+			out->writeUint32LE(entry.size);
+		}
+	}
+
+	out->finalize();
+	if (out->err())
+		warning("Could not write resource index %s", _audioMapIndexName.c_str());
+
+	delete out;
+}
+
+int32 ResourceManager::getIndexedFileSize(const Common::String &fileName) {
+	FileSizeMap::const_iterator it = _indexedFileSizes.find(fileName);
+	if (it != _indexedFileSizes.end())
+		return it->_value;
+
+	Common::File file;
+	int32 size = file.open(fileName) ? file.size() : -1;
+	_indexedFileSizes[fileName] = size;
+	return size;
+}
+
+bool ResourceManager::getAudioMapFiles(ResourceSource *map, IndexedAudioMap &indexedMap) {
+	Resource *mapRes = testResource(ResourceId(kResourceTypeMap, map->_volumeNumber));
+	ResourceSource *volume = findVolume(map, 0);
+
+	// Resources in Mac resource forks and chunks can't be checked through
+	// the size of their file
+	if (!mapRes || !volume || mapRes->_source->_resourceFile || volume->_resourceFile)
+		return false;
+
+	ResSourceType mapSourceType = mapRes->_source->getSourceType();
+	if (mapSourceType != kSourceVolume && mapSourceType != kSourcePatch)
+		return false;
+
+	indexedMap.mapFile = mapRes->_source->getLocationName();
+	indexedMap.mapOffset = mapRes->_fileOffset;
+	indexedMap.mapFileSize = getIndexedFileSize(indexedMap.mapFile);
+	indexedMap.volumeFile = volume->getLocationName();
+	indexedMap.volumeFileSize = getIndexedFileSize(indexedMap.volumeFile);
+	indexedMap.used = true;
+
+	return indexedMap.mapFileSize >= 0 && indexedMap.volumeFileSize >= 0;
+}
+
+int ResourceManager::scanAudioMapSCI11(ResourceSource *map) {
+	IndexedAudioMap current;
+	if (_audioMapIndexName.empty() || !getAudioMapFiles(map, current)) {
+		_audioMapsRead++;
+		return readAudioMapSCI11(map);
+	}
+
+	AudioMapIndex::iterator it = _audioMapIndex.find(map->_volumeNumber);
+	if (it != _audioMapIndex.end() && it->_value.sameFiles(current)) {
+		ResourceSource *src = findVolume(map, 0);
+		const Common::Array<IndexedAudioMapEntry> &entries = it->_value.entries;
+		for (uint32 i = 0; i < entries.size(); i++)
+			addResource(entries[i].id, src, entries[i].offset, entries[i].size);
+
+		it->_value.used = true;
+		_audioMapsIndexed++;
+		return 0;
+	}
+
+	IndexedAudioMap &indexedMap = _audioMapIndex[map->_volumeNumber];
+	indexedMap = current;
+
+	_recordingAudioMap = &indexedMap;
+	int result = readAudioMapSCI11(map);
+	_recordingAudioMap = 0;
+
+	_audioMapsRead++;
+	if (result != 0) {
+		_audioMapIndex.erase(map->_volumeNumber);
+		return result;
+	}
+
+	_audioMapIndexChanged = true;
+	return 0;
+}
+
 // AUDIOnnn.MAP contains 10-byte entries:
 // Early format:
 // w 5 bits resource type and 11 bits resource number
@@ -75,6 +75,11 @@ RobotDecoder::RobotDecoder(bool isBigEndian) {
 	_pos = Common::Point(0, 0);
 	_isBigEndian = isBigEndian;
 	_frameTotalSize = 0;
+	_framesRead = 0;
+
+	for (int i = 0; i < kDecodeAheadFrames; i++)
+		_frameQueue[i] = 0;
+	_frameQueueStart = _frameQueueCount = 0;
 }
 
 RobotDecoder::~RobotDecoder() {
@@ -143,17 +148,65 @@ void RobotDecoder::close() {
 
 	delete[] _frameTotalSize;
 	_frameTotalSize = 0;
+	_framesRead = 0;
+
+	for (int i = 0; i < kDecodeAheadFrames; i++) {
+		delete[] _frameQueue[i];
+		_frameQueue[i] = 0;
+	}
+	_frameQueueStart = _frameQueueCount = 0;
 }
 
 void RobotDecoder::readNextPacket() {
 	// Get our track
 	RobotVideoTrack *videoTrack = (RobotVideoTrack *)getTrack(0);
+
+	// A frame is late when it is shown after the next frame was due
+	const int curFrame = videoTrack->getCurFrame();
+	const uint32 time = getTime();
+	const uint32 frameTime = (uint32)videoTrack->getFrameTime(curFrame + 1).msecs();
+	if (time > frameTime) {
+		_stats.maxLateness = MAX(_stats.maxLateness, time - frameTime);
+		if (time >= (uint32)videoTrack->getFrameTime(curFrame + 2).msecs())
+			_stats.framesLate++;
+	}
+
 	videoTrack->increaseCurFrame();
 	Graphics::Surface *surface = videoTrack->getSurface();
 
 	if (videoTrack->endOfTrack())
 		return;
 
+	_stats.framesShown++;
+
+	if (_frameQueueCount) {
+		memcpy(surface->getPixels(), _frameQueue[_frameQueueStart], surface->w * surface->h);
+		_frameQueueStart = (_frameQueueStart + 1) % kDecodeAheadFrames;
+		_frameQueueCount--;
+		_stats.framesDecodedAhead++;
+	} else {
+		readFrame((byte *)surface->getPixels());
+	}
+}
+
+bool RobotDecoder::decodeAhead() {
+	if (!isVideoLoaded() || _frameQueueCount == kDecodeAheadFrames || _framesRead >= _header.frameCount)
+		return false;
+
+	const Graphics::Surface *surface = ((RobotVideoTrack *)getTrack(0))->getSurface();
+	const uint slot = (_frameQueueStart + _frameQueueCount) % kDecodeAheadFrames;
+
+	if (!_frameQueue[slot])
+		_frameQueue[slot] = new byte[surface->w * surface->h];
+
+	readFrame(_frameQueue[slot]);
+	_frameQueueCount++;
+	return true;
+}
+
+void RobotDecoder::readFrame(byte *outFrame) {
+	const Graphics::Surface *surface = ((RobotVideoTrack *)getTrack(0))->getSurface();
+
 	// Read frame image header (24 bytes)
 	_fileStream->skip(3);
 	byte frameScale = _fileStream->readByte();
@@ -214,7 +267,6 @@ void RobotDecoder::readNextPacket() {
 
 	// Copy over the decompressed frame
 	byte *inFrame = decompressedFrame;
-	byte *outFrame = (byte *)surface->getPixels();
 
 	// Black out the surface
 	memset(outFrame, 0, surface->w * surface->h);
@@ -230,7 +282,7 @@ void RobotDecoder::readNextPacket() {
 
 	delete[] decompressedFrame;
 
-	uint32 audioChunkSize = _frameTotalSize[videoTrack->getCurFrame()] - (24 + compressedSize);
+	uint32 audioChunkSize = _frameTotalSize[_framesRead++] - (24 + compressedSize);
 
 // TODO: The audio chunk size below is usually correct, but there are some
 // exceptions (e.g. robot 4902 in Phantasmagoria, towards its end)
@@ -37,6 +37,22 @@ class SeekableSubReadStreamEndian;
 
 namespace Sci {
 
+/**
+ * Statistics about the frames shown by RobotDecoder.
+ */
+struct RobotStats {
+	uint32 framesShown;
+	uint32 framesDecodedAhead; ///< frames decoded before they were needed
+	uint32 framesLate;         ///< frames shown when the next one was already due
+	uint32 maxLateness;        ///< in ms
+
+	RobotStats() { reset(); }
+
+	void reset() {
+		framesShown = framesDecodedAhead = framesLate = maxLateness = 0;
+	}
+};
+
 class RobotDecoder : public Video::VideoDecoder {
 public:
 	RobotDecoder(bool isBigEndian);
@@ -49,6 +65,16 @@ public:
 	void setPos(uint16 x, uint16 y) { _pos = Common::Point(x, y); }
 	Common::Point getPos() const { return _pos; }
 
+	/**
+	 * Decode the next frame which is not yet needed, if there is room for it.
+	 * This also queues its audio, so that the audio stream does not run dry.
+	 * Should be called while waiting for the next frame.
+	 * @return true if a frame was decoded
+	 */
+	bool decodeAhead();
+
+	RobotStats &getStats() { return _stats; }
+
 protected:
 	void readNextPacket();
 
@@ -116,9 +142,27 @@ private:
 	void readHeaderChunk();
 	void readFrameSizesChunk();
 
+	/**
+	 * Read the next frame from the file into the given buffer, which has the
+	 * size of the video surface, and queue its audio.
+	 */
+	void readFrame(byte *outFrame);
+
 	Common::Point _pos;
 	bool _isBigEndian;
 	uint32 *_frameTotalSize;
+	int _framesRead;
+
+	enum {
+		kDecodeAheadFrames = 8
+	};
+
+	// Frames decoded ahead, in a ring buffer
+	byte *_frameQueue[kDecodeAheadFrames];
+	uint _frameQueueStart;
+	uint _frameQueueCount;
+
+	RobotStats _stats;
 
 	Common::SeekableSubReadStreamEndian *_fileStream;
 };
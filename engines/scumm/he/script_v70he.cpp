@@ -406,7 +406,7 @@ void ScummEngine_v70he::o70_readINI() {
 		if (!strcmp((char *)option, "NoPrinting")) {
 			push(1);
 		} else if (!strcmp((char *)option, "TextOn")) {
-			push(ConfMan.getBool("subtitles"));
+			push(ConfMan.getBool(_subtitlesKey));
 		} else {
 			push(ConfMan.getInt((char *)option));
 		}
@@ -1793,7 +1793,7 @@ void ScummEngine_v72he::o72_readINI() {
 		if (!strcmp((char *)option, "DisablePrinting") || !strcmp((char *)option, "NoPrinting")) {
 			push(1);
 		} else if (!strcmp((char *)option, "TextOn")) {
-			push(ConfMan.getBool("subtitles"));
+			push(ConfMan.getBool(_subtitlesKey));
 		} else if (!strcmp((char *)option, "Disk") && (_game.id == GID_BIRTHDAYRED || _game.id == GID_BIRTHDAYYELLOW)) {
 			// WORKAROUND: Override the disk detection
 			// This removes the reliance on having the binary file around (which is
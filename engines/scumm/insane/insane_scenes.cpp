@@ -1457,7 +1457,7 @@ void Insane::postCaseAll(byte *renderBitmap, int32 codecparam, int32 setupsan12,
 	if (tsceneProp->actor != -1) {
 		if (_actor[tsceneProp->actor].field_54) {
 			tsceneProp->counter++;
-			if (!_actor[tsceneProp->actor].runningSound || ConfMan.getBool("subtitles")) {
+			if (!_actor[tsceneProp->actor].runningSound || ConfMan.getBool(_vm->_subtitlesKey)) {
 				if (_actor[tsceneProp->actor].act[3].state == 72 &&
 					_currTrsMsg) {
 					_player->setPaletteValue(0, tsceneProp->r, tsceneProp->g, tsceneProp->b);
@@ -571,7 +571,7 @@ bool ScummEngine::loadState(int slot, bool compat, Common::String &filename) {
 
 	// Sync with current config setting
 	if (VAR_VOICE_MODE != 0xFF)
-		VAR(VAR_VOICE_MODE) = ConfMan.getBool("subtitles");
+		VAR(VAR_VOICE_MODE) = ConfMan.getBool(_subtitlesKey);
 
 	debug(1, "State loaded from '%s'", filename.c_str());
 
@@ -553,10 +553,10 @@ int ScummEngine::readVar(uint var) {
 		}
 
 		if (VAR_SUBTITLES != 0xFF && var == VAR_SUBTITLES) {
-			return ConfMan.getBool("subtitles");
+			return ConfMan.getBool(_subtitlesKey);
 		}
 		if (VAR_NOSUBTITLES != 0xFF && var == VAR_NOSUBTITLES) {
-			return !ConfMan.getBool("subtitles");
+			return !ConfMan.getBool(_subtitlesKey);
 		}
 
 		assertRange(0, var, _numVariables - 1, "variable (reading)");
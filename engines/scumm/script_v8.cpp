@@ -1254,7 +1254,7 @@ void ScummEngine_v8::o8_kernelGetFunctions() {
 		else if (!strcmp(str, "Music Volume"))
 			push(ConfMan.getInt("music_volume") / 2);
 		else if (!strcmp(str, "Text Status"))
-			push(ConfMan.getBool("subtitles"));
+			push(ConfMan.getBool(_subtitlesKey));
 		else if (!strcmp(str, "Object Names"))
 			push(ConfMan.getBool("object_labels"));
 		else if (!strcmp(str, "Saveload Page"))
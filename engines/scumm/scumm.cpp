@@ -117,7 +117,8 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	  _debugger(0),
 	  _currentScript(0xFF), // Let debug() work on init stage
 	  _messageDialog(0), _pauseDialog(0), _versionDialog(0),
-	  _rnd("scumm")
+	  _rnd("scumm"),
+	  _subtitlesKey("subtitles"), _talkspeedKey("talkspeed")
 	  {
 
 #ifdef USE_RGB_COLOR
@@ -494,14 +495,14 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	}
 
 	// Make sure that at least subtitles are enabled
-	if (ConfMan.getBool("speech_mute") && !ConfMan.getBool("subtitles"))
+	if (ConfMan.getBool("speech_mute") && !ConfMan.getBool(_subtitlesKey))
 		ConfMan.setBool("subtitles", true);
 
 	// TODO Detect subtitle only versions of scumm6 games
 	if (ConfMan.getBool("speech_mute"))
 		_voiceMode = 2;
 	else
-		_voiceMode = ConfMan.getBool("subtitles");
+		_voiceMode = ConfMan.getBool(_subtitlesKey);
 
 	if (ConfMan.hasKey("render_mode")) {
 		_renderMode = Common::parseRenderMode(ConfMan.get("render_mode"));
@@ -1997,7 +1998,7 @@ void ScummEngine::syncSoundSettings() {
 	if (ConfMan.getBool("speech_mute"))
 		_voiceMode = 2;
 	else
-		_voiceMode = ConfMan.getBool("subtitles");
+		_voiceMode = ConfMan.getBool(_subtitlesKey);
 
 	if (VAR_VOICE_MODE != 0xFF)
 		VAR(VAR_VOICE_MODE) = _voiceMode;
@@ -2011,7 +2012,7 @@ void ScummEngine::syncSoundSettings() {
 	// Backyard Baseball 2003 uses a unique subtitle variable,
 	// rather than VAR_SUBTITLES
 	if (_game.id == GID_BASEBALL2003) {
-		_scummVars[632] = ConfMan.getBool("subtitles");
+		_scummVars[632] = ConfMan.getBool(_subtitlesKey);
 	}
 
 }
@@ -2021,7 +2022,7 @@ void ScummEngine::setTalkSpeed(int talkspeed) {
 }
 
 int ScummEngine::getTalkSpeed() {
-	return (ConfMan.getInt("talkspeed") * 9 + 255 / 2) / 255;
+	return (ConfMan.getInt(_talkspeedKey) * 9 + 255 / 2) / 255;
 }
 
 
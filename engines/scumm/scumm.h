@@ -25,6 +25,7 @@
 
 #include "engines/engine.h"
 
+#include "common/config-manager.h"
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
@@ -394,6 +395,10 @@ public:
 	/** Random number generator */
 	Common::RandomSource _rnd;
 
+	/** Settings which are checked every frame while text is shown */
+	Common::ConfigManager::KeyHandle _subtitlesKey;
+	Common::ConfigManager::KeyHandle _talkspeedKey;
+
 	/** Graphics manager */
 	Gdi *_gdi;
 
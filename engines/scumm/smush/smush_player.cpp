@@ -526,7 +526,7 @@ void SmushPlayer::handleTextResource(uint32 subType, int32 subSize, Common::Seek
 	// Query ConfMan here. However it may be slower, but
 	// player may want to switch the subtitles on or off during the
 	// playback. This fixes bug #1550974
-	if ((!ConfMan.getBool("subtitles")) && ((flags & 8) == 8))
+	if ((!ConfMan.getBool(_vm->_subtitlesKey)) && ((flags & 8) == 8))
 		return;
 
 	SmushFont *sf = getFont(0);
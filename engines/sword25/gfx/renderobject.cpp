@@ -69,7 +69,8 @@ RenderObject::RenderObject(RenderObjectPtr<RenderObject> parentPtr, TYPES type,
 	_refreshForced(true),
 	_handle(0),
 	_version(++_nextGlobalVersion),
-	_isSolid(false) {
+	_isSolid(false),
+	_needsRender(false) {
 
 	// Renderobject registrieren, abhngig vom Handle-Parameter entweder mit beliebigem oder vorgegebenen Handle.
 	if (handle == 0)
@@ -131,28 +132,24 @@ void RenderObject::preRender(RenderObjectQueue *renderQueue) {
 
 }
 
-bool RenderObject::render(RectangleList *updateRects, const Common::Array<int> &updateRectsMinZ) {
+bool RenderObject::render(RectangleList *updateRects) {
 
 	// Falls das Objekt nicht sichtbar ist, muss gar nichts gezeichnet werden
 	if (!_visible)
 		return true;
 
 	// Objekt zeichnen.
-	bool needRender = false;
-	int index = 0;
-
-	// Only draw if the bounding box intersects any update rectangle and
-	// the object is in front of the minimum Z value.
-	for (RectangleList::iterator rectIt = updateRects->begin(); !needRender && rectIt != updateRects->end(); ++rectIt, ++index)
-		needRender = (_bbox.contains(*rectIt) || _bbox.intersects(*rectIt)) && getAbsoluteZ() >= updateRectsMinZ[index];
-
-	if (needRender)
+	// The render object manager has already determined whether the object
+	// intersects any update rectangle in front of its minimum Z value.
+	if (_needsRender) {
+		_needsRender = false;
 		doRender(updateRects);
+	}
 
 	// Dann mssen die Kinder gezeichnet werden
 	RENDEROBJECT_ITER it = _children.begin();
 	for (; it != _children.end(); ++it)
-		if (!(*it)->render(updateRects, updateRectsMinZ))
+		if (!(*it)->render(updateRects))
 			return false;
 
 	return true;
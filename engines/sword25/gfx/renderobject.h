@@ -223,7 +223,7 @@ public:
 	            Dieses kann entweder direkt geschehen oder durch den Aufruf von UpdateObjectState() an einem Vorfahren-Objekt.<br>
 	            Diese Methode darf nur von BS_RenderObjectManager aufgerufen werden.
 	*/
-	bool render(RectangleList *updateRects, const Common::Array<int> &updateRectsMinZ);
+	bool render(RectangleList *updateRects);
 
 	/**
 	    @brief Bereitet das Objekt und alle seine Unterobjekte auf einen Rendervorgang vor.
@@ -372,6 +372,15 @@ public:
 		return _isSolid;
 	}
 
+	/**
+	    @brief Marks the object to be drawn by the next call of render().
+	    @remark Set by RenderObjectManager for all objects that overlap an update rectangle and are not hidden
+	            behind a solid object there.
+	*/
+	void setNeedsRender(bool needsRender) {
+		_needsRender = needsRender;
+	}
+
 	// Persistenz-Methoden
 	// -------------------
 	virtual bool persist(OutputPersistenceBlock &writer);
@@ -416,6 +425,8 @@ protected:
 	// This should be set to true if the RenderObject is NOT alpha-blended to optimize drawing
 	bool _isSolid;
 
+	bool _needsRender;
+
 	/// Ein Pointer auf den BS_RenderObjektManager, der das Objekt verwaltet.
 	RenderObjectManager *_managerPtr;
 
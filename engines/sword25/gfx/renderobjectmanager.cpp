@@ -31,6 +31,7 @@
 
 #include "sword25/gfx/renderobjectmanager.h"
 
+#include "sword25/sword25.h"	// for kDebugRender
 #include "sword25/kernel/kernel.h"
 #include "sword25/kernel/inputpersistenceblock.h"
 #include "sword25/kernel/outputpersistenceblock.h"
@@ -46,19 +47,57 @@
 namespace Sword25 {
 
 void RenderObjectQueue::add(RenderObject *renderObject) {
-	push_back(RenderObjectQueueItem(renderObject, renderObject->getBbox(), renderObject->getVersion()));
+	push_back(RenderObjectQueueItem(renderObject, renderObject->getBbox(), renderObject->getVersion(), renderObject->getHandle()));
+	_versions[renderObject->getHandle()] = renderObject->getVersion();
 }
 
 bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) {
-	for (RenderObjectQueue::iterator it = begin(); it != end(); ++it)
-		if ((*it)._renderObject == renderObjectQueueItem._renderObject &&
-			(*it)._version == renderObjectQueueItem._version)
-			return true;
-	return false;
+	// The handle is only compared here, the object pointer may already be dangling
+	Common::HashMap<uint32, int>::const_iterator it = _versions.find(renderObjectQueueItem._handle);
+	return it != _versions.end() && it->_value == renderObjectQueueItem._version;
+}
+
+void RenderObjectQueue::reset() {
+	clear();
+	_versions.clear();
+}
+
+RenderObjectGrid::RenderObjectGrid(int width, int height) :
+	_cellsW(MAX(1, (width + kCellSize - 1) / kCellSize)),
+	_cellsH(MAX(1, (height + kCellSize - 1) / kCellSize)) {
+	_cells.resize(_cellsW * _cellsH);
+}
+
+void RenderObjectGrid::build(const RenderObjectQueue &queue) {
+	for (uint i = 0; i < _cells.size(); ++i)
+		_cells[i].clear();
+
+	for (RenderObjectQueue::const_iterator it = queue.begin(); it != queue.end(); ++it) {
+		if ((*it)._bbox.isEmpty())
+			continue;
+
+		int x0, y0, x1, y1;
+		getCellRange((*it)._bbox, x0, y0, x1, y1);
+		for (int cellY = y0; cellY <= y1; ++cellY)
+			for (int cellX = x0; cellX <= x1; ++cellX)
+				_cells[cellY * _cellsW + cellX].push_back(&*it);
+	}
+}
+
+const RenderObjectGrid::Cell &RenderObjectGrid::getCell(int16 x, int16 y) const {
+	return getCellAt(CLIP<int>(x / kCellSize, 0, _cellsW - 1), CLIP<int>(y / kCellSize, 0, _cellsH - 1));
+}
+
+void RenderObjectGrid::getCellRange(const Common::Rect &rect, int &x0, int &y0, int &x1, int &y1) const {
+	x0 = CLIP<int>(rect.left / kCellSize, 0, _cellsW - 1);
+	y0 = CLIP<int>(rect.top / kCellSize, 0, _cellsH - 1);
+	x1 = CLIP<int>((rect.right - 1) / kCellSize, 0, _cellsW - 1);
+	y1 = CLIP<int>((rect.bottom - 1) / kCellSize, 0, _cellsH - 1);
 }
 
 RenderObjectManager::RenderObjectManager(int width, int height, int framebufferCount) :
-	_frameStarted(false) {
+	_frameStarted(false),
+	_grid(width, height) {
 	// Wurzel des BS_RenderObject-Baumes erzeugen.
 	_rootPtr = (new RootRenderObject(this, width, height))->getHandle();
 	_uta = new MicroTileArray(width, height);
@@ -97,7 +136,7 @@ bool RenderObjectManager::render() {
 
 	// Die Render-Methode der Wurzel aufrufen. Dadurch wird das rekursive Rendern der Baumelemente angestoen.
 
-	_currQueue->clear();
+	_currQueue->reset();
 	_rootPtr->preRender(_currQueue);
 
 	_uta->clear();
@@ -115,26 +154,49 @@ bool RenderObjectManager::render() {
 	}
 
 	RectangleList *updateRects = _uta->getRectangles();
-	Common::Array<int> updateRectsMinZ;
+	const uint32 startTime = g_system->getMillis();
+	uint objectCount = 0, rectCount = 0, pairsTested = 0;
+
+	_grid.build(*_currQueue);
 
-	updateRectsMinZ.reserve(updateRects->size());
+	for (RenderObjectQueue::iterator it = _currQueue->begin(); it != _currQueue->end(); ++it, ++objectCount)
+		(*it)._renderObject->setNeedsRender(false);
 
-	// Calculate the minimum drawing Z value of each update rectangle
-	// Solid bitmaps with a Z order less than the value calculated here would be overdrawn again and
-	// so don't need to be drawn in the first place which speeds things up a bit.
-	for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
+	for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt, ++rectCount) {
+		// Calculate the minimum drawing Z value of the update rectangle
+		// Solid bitmaps with a Z order less than the value calculated here would be overdrawn again and
+		// so don't need to be drawn in the first place which speeds things up a bit.
+		// An object containing the rectangle also contains its top left corner, so the cell of that
+		// corner lists all candidates in render order.
 		int minZ = 0;
-		for (RenderObjectQueue::iterator it = _currQueue->reverse_begin(); it != _currQueue->end(); --it) {
-			if ((*it)._renderObject->isVisible() && (*it)._renderObject->isSolid() &&
-				(*it)._renderObject->getBbox().contains(*rectIt)) {
-				minZ = (*it)._renderObject->getAbsoluteZ();
+		const RenderObjectGrid::Cell &cornerCell = _grid.getCell((*rectIt).left, (*rectIt).top);
+		for (int i = (int)cornerCell.size() - 1; i >= 0; --i) {
+			RenderObject *renderObject = cornerCell[i]->_renderObject;
+			if (renderObject->isVisible() && renderObject->isSolid() &&
+				renderObject->getBbox().contains(*rectIt)) {
+				minZ = renderObject->getAbsoluteZ();
 				break;
 			}
 		}
-		updateRectsMinZ.push_back(minZ);
+
+		// Only draw objects whose bounding box intersects the update rectangle and
+		// which are in front of the minimum Z value.
+		int x0, y0, x1, y1;
+		_grid.getCellRange(*rectIt, x0, y0, x1, y1);
+		for (int cellY = y0; cellY <= y1; ++cellY) {
+			for (int cellX = x0; cellX <= x1; ++cellX) {
+				const RenderObjectGrid::Cell &cell = _grid.getCellAt(cellX, cellY);
+				for (uint i = 0; i < cell.size(); ++i, ++pairsTested) {
+					RenderObject *renderObject = cell[i]->_renderObject;
+					const Common::Rect &bbox = renderObject->getBbox();
+					if ((bbox.contains(*rectIt) || bbox.intersects(*rectIt)) && renderObject->getAbsoluteZ() >= minZ)
+						renderObject->setNeedsRender(true);
+				}
+			}
+		}
 	}
 
-	if (_rootPtr->render(updateRects, updateRectsMinZ)) {
+	if (_rootPtr->render(updateRects)) {
 		// Copy updated rectangles to the video screen
 		Graphics::Surface *backSurface = Kernel::getInstance()->getGfx()->getSurface();
 		for (RectangleList::iterator rectIt = updateRects->begin(); rectIt != updateRects->end(); ++rectIt) {
@@ -148,6 +210,9 @@ bool RenderObjectManager::render() {
 
 	delete updateRects;
 
+	debugC(2, kDebugRender, "Rendered %d objects in %d update rects: %d of %d object/rect pairs tested, %d ms",
+	       objectCount, rectCount, pairsTested, objectCount * rectCount, g_system->getMillis() - startTime);
+
 	SWAP(_currQueue, _prevQueue);
 
 	return true;
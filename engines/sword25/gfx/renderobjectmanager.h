@@ -42,6 +42,8 @@
 #ifndef SWORD25_RENDEROBJECTMANAGER_H
 #define SWORD25_RENDEROBJECTMANAGER_H
 
+#include "common/array.h"
+#include "common/hashmap.h"
 #include "common/rect.h"
 #include "sword25/kernel/common.h"
 #include "sword25/gfx/renderobjectptr.h"
@@ -60,14 +62,54 @@ struct RenderObjectQueueItem {
 	RenderObject *_renderObject;
 	Common::Rect _bbox;
 	int _version;
-	RenderObjectQueueItem(RenderObject *renderObject, const Common::Rect &bbox, int version)
-		: _renderObject(renderObject), _bbox(bbox), _version(version) {}
+	uint32 _handle;
+	RenderObjectQueueItem(RenderObject *renderObject, const Common::Rect &bbox, int version, uint32 handle)
+		: _renderObject(renderObject), _bbox(bbox), _version(version), _handle(handle) {}
 };
 
 class RenderObjectQueue : public Common::List<RenderObjectQueueItem> {
 public:
 	void add(RenderObject *renderObject);
 	bool exists(const RenderObjectQueueItem &renderObjectQueueItem);
+	/** Removes all items, but keeps the storage of the version map for the next frame */
+	void reset();
+
+private:
+	// Version of every queued object, indexed by its handle
+	Common::HashMap<uint32, int> _versions;
+};
+
+/**
+    @brief Uniform grid over the screen which lists the render queue items overlapping each cell.
+
+    Items are listed in render order, so update rectangles only have to look at the objects that can touch them.
+*/
+class RenderObjectGrid {
+public:
+	typedef Common::Array<const RenderObjectQueueItem *> Cell;
+
+	RenderObjectGrid(int width, int height);
+
+	void build(const RenderObjectQueue &queue);
+	/**
+	    @brief Returns the cell containing the given point, clamped to the grid.
+	*/
+	const Cell &getCell(int16 x, int16 y) const;
+	/**
+	    @brief Returns the range of cells covered by a rectangle, clamped to the grid.
+	*/
+	void getCellRange(const Common::Rect &rect, int &x0, int &y0, int &x1, int &y1) const;
+	const Cell &getCellAt(int cellX, int cellY) const {
+		return _cells[cellY * _cellsW + cellX];
+	}
+
+private:
+	enum {
+		kCellSize = 64
+	};
+
+	int _cellsW, _cellsH;
+	Common::Array<Cell> _cells;
 };
 
 /**
@@ -133,6 +175,7 @@ private:
 
 	MicroTileArray *_uta;
 	RenderObjectQueue *_currQueue, *_prevQueue;
+	RenderObjectGrid _grid;
 
 	// RenderObject-Tree Variablen
 	// ---------------------------
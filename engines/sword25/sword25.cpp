@@ -68,6 +68,7 @@ Sword25Engine::Sword25Engine(OSystem *syst, const ADGameDescription *gameDesc):
 	DebugMan.addDebugChannel(kDebugScript, "Script", "Script debug level");
 	DebugMan.addDebugChannel(kDebugScript, "Scripts", "Script debug level");
 	DebugMan.addDebugChannel(kDebugSound, "Sound", "Sound debug level");
+	DebugMan.addDebugChannel(kDebugRender, "Render", "Render object manager debug level");
 
 	_console = new Sword25Console(this);
 }
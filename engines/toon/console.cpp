@@ -21,15 +21,40 @@
  */
 
 #include "toon/console.h"
+#include "toon/path.h"
 #include "toon/toon.h"
 
 namespace Toon {
 
 ToonConsole::ToonConsole(ToonEngine *vm) : GUI::Debugger(), _vm(vm) {
 	assert(_vm);
+
+	registerCmd("pathstats", WRAP_METHOD(ToonConsole, Cmd_PathStats));
 }
 
 ToonConsole::~ToonConsole() {
 }
 
+bool ToonConsole::Cmd_PathStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	PathFinding *pathFinding = _vm->getPathFinding();
+
+	if (argc == 2) {
+		pathFinding->resetStats();
+		debugPrintf("Path finding statistics reset\n");
+		return true;
+	}
+
+	const PathFindingStats &stats = pathFinding->getStats();
+	debugPrintf("Path queries: %d\n", stats._queries);
+	debugPrintf("Searches: %d (%d unreachable)\n", stats._searches, stats._unreachable);
+	debugPrintf("Expanded nodes: %d\n", stats._expandedNodes);
+	debugPrintf("Search time: %d ms total, %d ms max\n", stats._totalTime, stats._maxTime);
+	return true;
+}
+
 } // End of namespace Toon
@@ -21,6 +21,7 @@
  */
 
 #include "common/debug.h"
+#include "common/system.h"
 
 #include "toon/path.h"
 
@@ -151,6 +152,11 @@ PathFinding::PathFinding() {
 	_height = 0;
 	_heap = new PathFindingHeap();
 	_sq = NULL;
+	_sqMinY = 0;
+	_sqMaxY = -1;
+	_areas = NULL;
+	_areasMaskVersion = 0;
+	_areasValid = false;
 	_numBlockingRects = 0;
 
 	_currentMask = nullptr;
@@ -161,6 +167,7 @@ PathFinding::~PathFinding(void) {
 		_heap->unload();
 	delete _heap;
 	delete[] _sq;
+	delete[] _areas;
 }
 
 void PathFinding::init(Picture *mask) {
@@ -173,6 +180,92 @@ void PathFinding::init(Picture *mask) {
 	_heap->init(500);
 	delete[] _sq;
 	_sq = new uint16[_width * _height];
+	memset(_sq, 0, _width * _height * sizeof(uint16));
+	_sqMinY = 0;
+	_sqMaxY = -1;
+	delete[] _areas;
+	_areas = new uint16[_width * _height];
+	_areasValid = false;
+}
+
+void PathFinding::updateAreas() {
+	if (_areasValid && _areasMaskVersion == _currentMask->getMaskVersion())
+		return;
+
+	debugC(1, kDebugPath, "updateAreas()");
+
+	_areasMaskVersion = _currentMask->getMaskVersion();
+	_areasValid = true;
+
+	const uint8 *mask = _currentMask->getDataPtr();
+	memset(_areas, 0, _width * _height * sizeof(uint16));
+
+	// Flood fill every walkable area, with the same eight neighbours that
+	// findPath() moves to
+	Common::Array<int32> stack;
+	uint16 numAreas = 0;
+	for (int32 start = 0; start < _width * _height; start++) {
+		if (_areas[start] || !(mask[start] & 0x1f))
+			continue;
+
+		if (numAreas == 0xFFFF) {
+			// Not going to happen with real masks, just don't use the areas
+			_areasValid = false;
+			return;
+		}
+
+		numAreas++;
+		_areas[start] = numAreas;
+		stack.push_back(start);
+
+		while (!stack.empty()) {
+			const int32 node = stack.back();
+			stack.pop_back();
+
+			const int16 nodeX = node % _width;
+			const int16 nodeY = node / _width;
+			const int16 endX = MIN<int16>(nodeX + 1, _width - 1);
+			const int16 endY = MIN<int16>(nodeY + 1, _height - 1);
+
+			for (int16 py = MAX<int16>(nodeY - 1, 0); py <= endY; py++) {
+				for (int16 px = MAX<int16>(nodeX - 1, 0); px <= endX; px++) {
+					const int32 next = px + py * _width;
+					if (!_areas[next] && (mask[next] & 0x1f)) {
+						_areas[next] = numAreas;
+						stack.push_back(next);
+					}
+				}
+			}
+		}
+	}
+
+	debugC(1, kDebugPath, "%d walkable areas", numAreas);
+}
+
+bool PathFinding::isReachable(int16 x, int16 y, int16 destX, int16 destY) {
+	if (x >= _width || y >= _height || destX >= _width || destY >= _height)
+		return true;
+
+	updateAreas();
+	if (!_areasValid)
+		return true;
+
+	const uint16 destArea = _areas[destX + destY * _width];
+	if (!destArea)
+		return false;
+
+	// The starting point itself does not have to be walkable, the search
+	// continues from whichever neighbours are
+	const int16 endX = MIN<int16>(x + 1, _width - 1);
+	const int16 endY = MIN<int16>(y + 1, _height - 1);
+	for (int16 py = MAX<int16>(y - 1, 0); py <= endY; py++) {
+		for (int16 px = MAX<int16>(x - 1, 0); px <= endX; px++) {
+			if (_areas[px + py * _width] == destArea)
+				return true;
+		}
+	}
+
+	return false;
 }
 
 bool PathFinding::isLikelyWalkable(int16 x, int16 y) {
@@ -288,6 +381,8 @@ bool PathFinding::lineIsWalkable(int16 x, int16 y, int16 x2, int16 y2) {
 bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 	debugC(1, kDebugPath, "findPath(%d, %d, %d, %d)", x, y, destx, desty);
 
+	_stats._queries++;
+
 	if (x == destx && y == desty) {
 		_tempPath.clear();
 		return true;
@@ -305,33 +400,60 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 		return true;
 	}
 
-	// no direct line, we use the standard A* algorithm
-	memset(_sq , 0, _width * _height * sizeof(uint16));
+	_stats._searches++;
+
+	if (!isReachable(x, y, destx, desty)) {
+		_stats._unreachable++;
+		_tempPath.clear();
+		return false;
+	}
+
+	uint32 startTime = g_system->getMillis();
+
+	// No direct line, we search for the shortest path. Points are visited
+	// in order of their distance from the start. Once the destination is
+	// next, every point closer than it has its final distance: the path is
+	// traced back through these only, so the search can stop there.
+	for (int16 py = _sqMinY; py <= _sqMaxY; py++)
+		memset(_sq + py * _width, 0, _width * sizeof(uint16));
+	_sqMinY = _sqMaxY = y;
+
 	_heap->clear();
 	int16 curX = x;
 	int16 curY = y;
 	uint16 curWeight = 0;
 
+	const uint8 *mask = _currentMask->getDataPtr();
+	const int32 destNode = destx + desty * _width;
+
 	_sq[curX + curY *_width] = 1;
-	_heap->push(curX, curY, abs(destx - x) + abs(desty - y));
+	_heap->push(curX, curY, 1);
 
 	while (_heap->getCount()) {
 		_heap->pop(&curX, &curY, &curWeight);
 		int32 curNode = curX + curY * _width;
 
+		// Skip points a shorter way was found to after they were queued
+		if (curWeight > _sq[curNode])
+			continue;
+
+		if (_sq[destNode] && curWeight >= _sq[destNode])
+			break;
+
+		_stats._expandedNodes++;
+
 		int16 endX = MIN<int16>(curX + 1, _width - 1);
 		int16 endY = MIN<int16>(curY + 1, _height - 1);
 		int16 startX = MAX<int16>(curX - 1, 0);
 		int16 startY = MAX<int16>(curY - 1, 0);
-		bool next = false;
 
-		for (int16 px = startX; px <= endX && !next; px++) {
-			for (int16 py = startY; py <= endY && !next; py++) {
+		for (int16 px = startX; px <= endX; px++) {
+			for (int16 py = startY; py <= endY; py++) {
 				if (px != curX || py != curY) {
 					uint16 wei = abs(px - curX) + abs(py - curY);
 
-					if (isWalkable(px, py)) { // walkable ?
-						int32 curPNode = px + py * _width;
+					int32 curPNode = px + py * _width;
+					if (mask[curPNode] & 0x1f) { // walkable ?
 						uint32 sum = _sq[curNode] + wei * (1 + (isLikelyWalkable(px, py) ? 5 : 0));
 						if (sum > (uint32)0xFFFF) {
 							warning("PathFinding::findPath sum exceeds maximum representable!");
@@ -339,14 +461,9 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 						}
 						if (_sq[curPNode] > sum || !_sq[curPNode]) {
 							_sq[curPNode] = sum;
-							uint32 newWeight = _sq[curPNode] + abs(destx - px) + abs(desty - py);
-							if (newWeight > (uint32)0xFFFF) {
-								warning("PathFinding::findPath newWeight exceeds maximum representable!");
-								newWeight = (uint16)0xFFFF;
-							}
-							_heap->push(px, py, newWeight);
-							if (!newWeight)
-								next = true; // we found it !
+							_sqMinY = MIN(_sqMinY, py);
+							_sqMaxY = MAX(_sqMaxY, py);
+							_heap->push(px, py, sum);
 						}
 					}
 				}
@@ -354,6 +471,10 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 		}
 	}
 
+	uint32 searchTime = g_system->getMillis() - startTime;
+	_stats._totalTime += searchTime;
+	_stats._maxTime = MAX(_stats._maxTime, searchTime);
+
 	// let's see if we found a result !
 	if (!_sq[destx + desty * _width]) {
 		// didn't find anything
@@ -55,6 +55,21 @@ private:
 	uint32 _count;
 };
 
+struct PathFindingStats {
+	uint32 _queries;       // findPath() calls
+	uint32 _searches;      // of these, the ones without a direct line
+	uint32 _unreachable;   // searches given up because of the walk areas
+	uint32 _expandedNodes;
+	uint32 _totalTime;     // time spent in searches, in milliseconds
+	uint32 _maxTime;
+
+	PathFindingStats() { reset(); }
+	void reset() {
+		_queries = _searches = _unreachable = _expandedNodes = 0;
+		_totalTime = _maxTime = 0;
+	}
+};
+
 class PathFinding {
 public:
 	PathFinding();
@@ -77,6 +92,9 @@ public:
 	int16 getPathNodeX(uint32 nodeId) const { return _tempPath[(_tempPath.size() - 1) - nodeId].x; }
 	int16 getPathNodeY(uint32 nodeId) const { return _tempPath[(_tempPath.size() - 1) - nodeId].y; }
 
+	const PathFindingStats &getStats() const { return _stats; }
+	void resetStats() { _stats.reset(); }
+
 private:
 	static const uint8 kMaxBlockingRects = 16;
 
@@ -88,6 +106,21 @@ private:
 	int16 _width;
 	int16 _height;
 
+	// Rows of _sq written by the last search, cleared before the next one
+	int16 _sqMinY;
+	int16 _sqMaxY;
+
+	// Connected walkable areas of the mask, numbered from 1. They are rebuilt
+	// whenever the mask changes, and let searches for a destination in another
+	// area fail without visiting every point they can reach.
+	uint16 *_areas;
+	uint32 _areasMaskVersion;
+	bool _areasValid;
+	void updateAreas();
+	bool isReachable(int16 x, int16 y, int16 destX, int16 destY);
+
+	PathFindingStats _stats;
+
 	Common::Array<Common::Point> _tempPath;
 
 	int16 _blockingRects[kMaxBlockingRects][5];
@@ -51,6 +51,9 @@ public:
 	int16 getWidth() const { return _width; }
 	int16 getHeight() const { return _height; }
 
+	// Changes whenever the walkable areas on the mask are modified
+	uint32 getMaskVersion() const { return _maskVersion; }
+
 protected:
 	int16 _width;
 	int16 _height;
@@ -58,6 +61,7 @@ protected:
 	uint8 *_palette; // need to be copied at 3-387
 	int32 _paletteEntries;
 	bool _useFullPalette;
+	uint32 _maskVersion;
 
 	ToonEngine *_vm;
 };
@@ -66,8 +66,87 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(AdGame, true)
 
+// Methods handled by AdGame::scCallMethod(), in the order of their names below
+enum {
+	kAdGameMethodChangeScene = 0,
+	kAdGameMethodLoadActor,
+	kAdGameMethodLoadEntity,
+	kAdGameMethodUnloadObject,
+	kAdGameMethodUnloadActor,
+	kAdGameMethodUnloadEntity,
+	kAdGameMethodDeleteEntity,
+	kAdGameMethodCreateEntity,
+	kAdGameMethodCreateItem,
+	kAdGameMethodDeleteItem,
+	kAdGameMethodQueryItem,
+	kAdGameMethodAddResponse,
+	kAdGameMethodAddResponseOnce,
+	kAdGameMethodAddResponseOnceGame,
+	kAdGameMethodResetResponse,
+	kAdGameMethodClearResponses,
+	kAdGameMethodGetResponse,
+	kAdGameMethodGetNumResponses,
+	kAdGameMethodStartDlgBranch,
+	kAdGameMethodEndDlgBranch,
+	kAdGameMethodGetCurrentDlgBranch,
+	kAdGameMethodTakeItem,
+	kAdGameMethodDropItem,
+	kAdGameMethodGetItem,
+	kAdGameMethodHasItem,
+	kAdGameMethodIsItemTaken,
+	kAdGameMethodGetInventoryWindow,
+	kAdGameMethodGetResponsesWindow,
+	kAdGameMethodGetResponseWindow,
+	kAdGameMethodLoadResponseBox,
+	kAdGameMethodLoadInventoryBox,
+	kAdGameMethodLoadItems,
+	kAdGameMethodAddSpeechDir,
+	kAdGameMethodRemoveSpeechDir,
+	kAdGameMethodSetSceneViewport,
+};
+
+static const char *const adGameMethodNames[] = {
+	"ChangeScene",
+	"LoadActor",
+	"LoadEntity",
+	"UnloadObject",
+	"UnloadActor",
+	"UnloadEntity",
+	"DeleteEntity",
+	"CreateEntity",
+	"CreateItem",
+	"DeleteItem",
+	"QueryItem",
+	"AddResponse",
+	"AddResponseOnce",
+	"AddResponseOnceGame",
+	"ResetResponse",
+	"ClearResponses",
+	"GetResponse",
+	"GetNumResponses",
+	"StartDlgBranch",
+	"EndDlgBranch",
+	"GetCurrentDlgBranch",
+	"TakeItem",
+	"DropItem",
+	"GetItem",
+	"HasItem",
+	"IsItemTaken",
+	"GetInventoryWindow",
+	"GetResponsesWindow",
+	"GetResponseWindow",
+	"LoadResponseBox",
+	"LoadInventoryBox",
+	"LoadItems",
+	"AddSpeechDir",
+	"RemoveSpeechDir",
+	"SetSceneViewport",
+};
+
 //////////////////////////////////////////////////////////////////////////
 AdGame::AdGame(const Common::String &gameId) : BaseGame(gameId) {
+	_methodTable.init(adGameMethodNames, ARRAYSIZE(adGameMethodNames));
+
 	_responseBox = nullptr;
 	_inventoryBox = nullptr;
 
@@ -347,10 +426,15 @@ void AdGame::finishSentences() {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	int method = _methodTable.getId(name);
+	if (method < 0) {
+		return BaseGame::scCallMethod(script, stack, thisStack, name);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// ChangeScene
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "ChangeScene") == 0) {
+	if (method == kAdGameMethodChangeScene) {
 		stack->correctParams(3);
 		const char *filename = stack->pop()->getString();
 		ScValue *valFadeOut = stack->pop();
@@ -376,7 +460,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadActor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadActor") == 0) {
+	else if (method == kAdGameMethodLoadActor) {
 		stack->correctParams(1);
 		AdActor *act = new AdActor(_gameRef);
 		if (act && DID_SUCCEED(act->loadFile(stack->pop()->getString()))) {
@@ -393,7 +477,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadEntity") == 0) {
+	else if (method == kAdGameMethodLoadEntity) {
 		stack->correctParams(1);
 		AdEntity *ent = new AdEntity(_gameRef);
 		if (ent && DID_SUCCEED(ent->loadFile(stack->pop()->getString()))) {
@@ -410,7 +494,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadObject / UnloadActor / UnloadEntity / DeleteEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadObject") == 0 || strcmp(name, "UnloadActor") == 0 || strcmp(name, "UnloadEntity") == 0 || strcmp(name, "DeleteEntity") == 0) {
+	else if (method == kAdGameMethodUnloadObject || method == kAdGameMethodUnloadActor || method == kAdGameMethodUnloadEntity || method == kAdGameMethodDeleteEntity) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		AdObject *obj = (AdObject *)val->getNative();
@@ -426,7 +510,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// CreateEntity
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateEntity") == 0) {
+	else if (method == kAdGameMethodCreateEntity) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -442,7 +526,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// CreateItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateItem") == 0) {
+	else if (method == kAdGameMethodCreateItem) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -458,7 +542,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteItem") == 0) {
+	else if (method == kAdGameMethodDeleteItem) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -480,7 +564,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// QueryItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "QueryItem") == 0) {
+	else if (method == kAdGameMethodQueryItem) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -507,7 +591,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddResponse/AddResponseOnce/AddResponseOnceGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddResponse") == 0 || strcmp(name, "AddResponseOnce") == 0 || strcmp(name, "AddResponseOnceGame") == 0) {
+	else if (method == kAdGameMethodAddResponse || method == kAdGameMethodAddResponseOnce || method == kAdGameMethodAddResponseOnceGame) {
 		stack->correctParams(6);
 		int id = stack->pop()->getInt();
 		const char *text = stack->pop()->getString();
@@ -559,7 +643,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ResetResponse
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResetResponse") == 0) {
+	else if (method == kAdGameMethodResetResponse) {
 		stack->correctParams(1);
 		int id = stack->pop()->getInt(-1);
 		resetResponse(id);
@@ -570,7 +654,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// ClearResponses
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClearResponses") == 0) {
+	else if (method == kAdGameMethodClearResponses) {
 		stack->correctParams(0);
 		_responseBox->clearResponses();
 		_responseBox->clearButtons();
@@ -581,7 +665,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetResponse
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetResponse") == 0) {
+	else if (method == kAdGameMethodGetResponse) {
 		stack->correctParams(1);
 		bool autoSelectLast = stack->pop()->getBool();
 
@@ -617,7 +701,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetNumResponses
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetNumResponses") == 0) {
+	else if (method == kAdGameMethodGetNumResponses) {
 		stack->correctParams(0);
 		if (_responseBox) {
 			_responseBox->weedResponses();
@@ -633,7 +717,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// StartDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StartDlgBranch") == 0) {
+	else if (method == kAdGameMethodStartDlgBranch) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		Common::String branchName;
@@ -652,7 +736,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// EndDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EndDlgBranch") == 0) {
+	else if (method == kAdGameMethodEndDlgBranch) {
 		stack->correctParams(1);
 
 		const char *branchName = nullptr;
@@ -670,7 +754,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetCurrentDlgBranch
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCurrentDlgBranch") == 0) {
+	else if (method == kAdGameMethodGetCurrentDlgBranch) {
 		stack->correctParams(0);
 
 		if (_dlgPendingBranches.size() > 0) {
@@ -685,35 +769,35 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// TakeItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "TakeItem") == 0) {
+	else if (method == kAdGameMethodTakeItem) {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// DropItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DropItem") == 0) {
+	else if (method == kAdGameMethodDropItem) {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// GetItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetItem") == 0) {
+	else if (method == kAdGameMethodGetItem) {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// HasItem
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasItem") == 0) {
+	else if (method == kAdGameMethodHasItem) {
 		return _invObject->scCallMethod(script, stack, thisStack, name);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// IsItemTaken
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsItemTaken") == 0) {
+	else if (method == kAdGameMethodIsItemTaken) {
 		stack->correctParams(1);
 
 		ScValue *val = stack->pop();
@@ -742,7 +826,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetInventoryWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetInventoryWindow") == 0) {
+	else if (method == kAdGameMethodGetInventoryWindow) {
 		stack->correctParams(0);
 		if (_inventoryBox && _inventoryBox->_window) {
 			stack->pushNative(_inventoryBox->_window, true);
@@ -756,7 +840,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// GetResponsesWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetResponsesWindow") == 0 || strcmp(name, "GetResponseWindow") == 0) {
+	else if (method == kAdGameMethodGetResponsesWindow || method == kAdGameMethodGetResponseWindow) {
 		stack->correctParams(0);
 		if (_responseBox && _responseBox->getResponseWindow()) {
 			stack->pushNative(_responseBox->getResponseWindow(), true);
@@ -770,7 +854,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadResponseBox
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadResponseBox") == 0) {
+	else if (method == kAdGameMethodLoadResponseBox) {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -790,7 +874,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadInventoryBox
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadInventoryBox") == 0) {
+	else if (method == kAdGameMethodLoadInventoryBox) {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -810,7 +894,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// LoadItems
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadItems") == 0) {
+	else if (method == kAdGameMethodLoadItems) {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		bool merge = stack->pop()->getBool(false);
@@ -824,7 +908,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// AddSpeechDir
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AddSpeechDir") == 0) {
+	else if (method == kAdGameMethodAddSpeechDir) {
 		stack->correctParams(1);
 		const char *dir = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(addSpeechDir(dir)));
@@ -835,7 +919,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveSpeechDir
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveSpeechDir") == 0) {
+	else if (method == kAdGameMethodRemoveSpeechDir) {
 		stack->correctParams(1);
 		const char *dir = stack->pop()->getString();
 		stack->pushBool(DID_SUCCEED(removeSpeechDir(dir)));
@@ -846,7 +930,7 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 	//////////////////////////////////////////////////////////////////////////
 	// SetSceneViewport
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSceneViewport") == 0) {
+	else if (method == kAdGameMethodSetSceneViewport) {
 		stack->correctParams(4);
 		int x = stack->pop()->getInt();
 		int y = stack->pop()->getInt();
@@ -881,6 +965,10 @@ bool AdGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack,
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *AdGame::scGetProperty(const Common::String &name) {
+	if (_passOnNames._getProperties.contains(name)) {
+		return BaseGame::scGetProperty(name);
+	}
+
 	_scValue->setNULL();
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1057,6 +1145,7 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 	}
 
 	else {
+		_passOnNames._getProperties.setVal(name, true);
 		return BaseGame::scGetProperty(name);
 	}
 }
@@ -1064,6 +1153,9 @@ ScValue *AdGame::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool AdGame::scSetProperty(const char *name, ScValue *value) {
+	if (_passOnNames._setProperties.contains(name)) {
+		return BaseGame::scSetProperty(name, value);
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// SelectedItem
@@ -1173,6 +1265,7 @@ bool AdGame::scSetProperty(const char *name, ScValue *value) {
 	}
 
 	else {
+		_passOnNames._setProperties.setVal(name, true);
 		return BaseGame::scSetProperty(name, value);
 	}
 }
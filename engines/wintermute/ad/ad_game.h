@@ -133,6 +133,9 @@ public:
 private:
 	virtual bool externalCall(ScScript *script, ScStack *stack, ScStack *thisStack, char *name) override;
 
+	ScPassOnNames _passOnNames;
+	ScNameTable _methodTable;
+
 	AdObject *_invObject;
 	BaseArray<AdInventory *> _inventories;
 	char *_scheduledScene;
@@ -327,6 +327,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	else if (strcmp(name, "Blocked") == 0) {
 		_blocked = value->getBool();
+		changed();
 		return STATUS_OK;
 	}
 
@@ -335,6 +336,7 @@ bool AdRegion::scSetProperty(const char *name, ScValue *value) {
 	//////////////////////////////////////////////////////////////////////////
 	else if (strcmp(name, "Decoration") == 0) {
 		_decoration = value->getBool();
+		changed();
 		return STATUS_OK;
 	}
 
@@ -175,6 +175,9 @@ void AdScene::cleanup() {
 	}
 	_pfPath.clear();
 	_pfPointsNum = 0;
+	_pfOpenList.clear();
+	_pfVisibility.clear();
+	_pfBlockingState.clear();
 
 	for (uint32 i = 0; i < _objects.size(); i++) {
 		_gameRef->unregisterObject(_objects[i]);
@@ -201,6 +204,13 @@ bool AdScene::getPath(const BasePoint &source, const BasePoint &target, AdPath *
 		_pfTargetPath->reset();
 		_pfTargetPath->setReady(false);
 
+		_pfStats._searches++;
+
+		// forget the cached lines of sight if any region changed since they were traced
+		if (updateBlockingState()) {
+			_pfVisibility.clear();
+		}
+
 		// prepare working path
 		pfPointsStart();
 
@@ -336,22 +346,8 @@ uint32 AdScene::getAlphaAt(int x, int y, bool colorCheck) {
 bool AdScene::isBlockedAt(int x, int y, bool checkFreeObjects, BaseObject *requester) {
 	bool ret = true;
 
-	if (checkFreeObjects) {
-		for (uint32 i = 0; i < _objects.size(); i++) {
-			if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
-				if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
-			}
-		}
-		AdGame *adGame = (AdGame *)_gameRef;
-		for (uint32 i = 0; i < adGame->_objects.size(); i++) {
-			if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
-				if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
-					return true;
-				}
-			}
-		}
+	if (checkFreeObjects && isBlockedByFreeObjectAt(x, y, requester)) {
+		return true;
 	}
 
 
@@ -419,8 +415,126 @@ bool AdScene::isWalkableAt(int x, int y, bool checkFreeObjects, BaseObject *requ
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isBlockedByFreeObjectAt(int x, int y, BaseObject *requester) {
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
+			if (_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
+			}
+		}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
+			if (adGame->_objects[i]->_currentBlockRegion->pointInRegion(x, y)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::hasFreeBlockers(BaseObject *requester) {
+	for (uint32 i = 0; i < _objects.size(); i++) {
+		if (_objects[i]->_active && _objects[i] != requester && _objects[i]->_currentBlockRegion) {
+			return true;
+		}
+	}
+	AdGame *adGame = (AdGame *)_gameRef;
+	for (uint32 i = 0; i < adGame->_objects.size(); i++) {
+		if (adGame->_objects[i]->_active && adGame->_objects[i] != requester && adGame->_objects[i]->_currentBlockRegion) {
+			return true;
+		}
+	}
+	return false;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject *requester) {
+	if (isSegmentBlocked(p1, p2, true, true, requester)) {
+		return -1;
+	}
+	return MAX(abs(p2.x - p1.x), abs(p2.y - p1.y));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+int AdScene::getCachedPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject *requester) {
+	if (p1.x != (int16)p1.x || p1.y != (int16)p1.y || p2.x != (int16)p2.x || p2.y != (int16)p2.y) {
+		return getPointsDist(p1, p2, requester);
+	}
+
+	// lines are always traced starting at the same end, so the key doesn't depend on the order of the points
+	uint32 key1 = ((uint16)p1.x << 16) | (uint16)p1.y;
+	uint32 key2 = ((uint16)p2.x << 16) | (uint16)p2.y;
+	uint64 key = key1 < key2 ? ((uint64)key1 << 32) | key2 : ((uint64)key2 << 32) | key1;
+
+	bool visible;
+	Common::HashMap<uint64, bool, VisibilityKeyHash>::const_iterator it = _pfVisibility.find(key);
+	if (it != _pfVisibility.end()) {
+		visible = it->_value;
+		_pfStats._cacheHits++;
+	} else {
+		visible = !isSegmentBlocked(p1, p2, true, false, requester);
+		_pfVisibility[key] = visible;
+		_pfStats._segmentChecks++;
+	}
+
+	if (!visible || (hasFreeBlockers(requester) && isSegmentBlocked(p1, p2, false, true, requester))) {
+		return -1;
+	}
+	return MAX(abs(p2.x - p1.x), abs(p2.y - p1.y));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::updateBlockingState() {
+	bool changed = false;
+	uint32 count = 0;
+
+	if (_mainLayer) {
+		for (uint32 i = 0; i < _mainLayer->_nodes.size(); i++) {
+			AdSceneNode *node = _mainLayer->_nodes[i];
+			if (node->_type != OBJECT_REGION) {
+				continue;
+			}
+
+			AdRegion *region = node->_region;
+			if (count < _pfBlockingState.size()) {
+				PathFinderRegionState &state = _pfBlockingState[count];
+				if (state._region != region || state._version != region->getVersion() || state._active != region->_active) {
+					state._region = region;
+					state._version = region->getVersion();
+					state._active = region->_active;
+					changed = true;
+				}
+			} else {
+				PathFinderRegionState state;
+				state._region = region;
+				state._version = region->getVersion();
+				state._active = region->_active;
+				_pfBlockingState.push_back(state);
+				changed = true;
+			}
+			count++;
+		}
+	}
+
+	if (count != _pfBlockingState.size()) {
+		_pfBlockingState.resize(count);
+		changed = true;
+	}
+
+	return changed;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool AdScene::isSegmentBlocked(const BasePoint &p1, const BasePoint &p2, bool checkLayer, bool checkFreeObjects, BaseObject *requester) {
 	double xStep, yStep, x, y;
 	int xLength, yLength, xCount, yCount;
 	int x1, y1, x2, y2;
@@ -443,8 +557,8 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		y = y1;
 
 		for (xCount = x1; xCount < x2; xCount++) {
-			if (isBlockedAt(xCount, (int)y, true, requester)) {
-				return -1;
+			if ((checkFreeObjects && isBlockedByFreeObjectAt(xCount, (int)y, requester)) || (checkLayer && isBlockedAt(xCount, (int)y))) {
+				return true;
 			}
 			y += yStep;
 		}
@@ -458,28 +572,20 @@ int AdScene::getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject
 		x = x1;
 
 		for (yCount = y1; yCount < y2; yCount++) {
-			if (isBlockedAt((int)x, yCount, true, requester)) {
-				return -1;
+			if ((checkFreeObjects && isBlockedByFreeObjectAt((int)x, yCount, requester)) || (checkLayer && isBlockedAt((int)x, yCount))) {
+				return true;
 			}
 			x += xStep;
 		}
 	}
-	return MAX(xLength, yLength);
+	return false;
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pathFinderStep() {
-	int i;
-	// get lowest unmarked
-	int lowestDist = INT_MAX;
-	AdPathPoint *lowestPt = nullptr;
-
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked && _pfPath[i]->_distance < lowestDist) {
-			lowestDist = _pfPath[i]->_distance;
-			lowestPt = _pfPath[i];
-		}
+	// get the unmarked point with the lowest estimated total distance
+	AdPathPoint *lowestPt = pfOpenListPop();
 
 	if (lowestPt == nullptr) { // no path -> terminate PathFinder
 		_pfReady = true;
@@ -488,6 +594,7 @@ void AdScene::pathFinderStep() {
 	}
 
 	lowestPt->_marked = true;
+	_pfStats._steps++;
 
 	// target point marked, generate path and terminate
 	if (lowestPt->x == _pfTarget->x && lowestPt->y == _pfTarget->y) {
@@ -502,14 +609,105 @@ void AdScene::pathFinderStep() {
 	}
 
 	// otherwise keep on searching
-	for (i = 0; i < _pfPointsNum; i++)
-		if (!_pfPath[i]->_marked) {
-			int j = getPointsDist(*lowestPt, *_pfPath[i], _pfRequester);
-			if (j != -1 && lowestPt->_distance + j < _pfPath[i]->_distance) {
-				_pfPath[i]->_distance = lowestPt->_distance + j;
-				_pfPath[i]->_origin = lowestPt;
+	for (int32 i = 0; i < _pfPointsNum; i++) {
+		AdPathPoint *point = _pfPath[i];
+		if (point->_marked) {
+			continue;
+		}
+
+		// a free line of sight costs the longer of the two axis distances, don't
+		// bother tracing lines that couldn't make the path shorter anyway
+		int dist = MAX(abs(point->x - lowestPt->x), abs(point->y - lowestPt->y));
+		if (lowestPt->_distance + dist >= point->_distance) {
+			continue;
+		}
+
+		// the start and target points change with every search, caching lines
+		// to them would only fill the cache
+		bool endPoint = lowestPt == _pfPath[0] || lowestPt == _pfPath[1] || point == _pfPath[0] || point == _pfPath[1];
+		if (endPoint) {
+			_pfStats._segmentChecks++;
+		}
+
+		if ((endPoint ? getPointsDist(*lowestPt, *point, _pfRequester) : getCachedPointsDist(*lowestPt, *point, _pfRequester)) != -1) {
+			point->_distance = lowestPt->_distance + dist;
+			point->_origin = lowestPt;
+			pfOpenListPush(point);
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+int AdScene::pfEstimate(const AdPathPoint *point) const {
+	// never more than the real distance, which keeps the A* search optimal
+	return MAX(abs(_pfTarget->x - point->x), abs(_pfTarget->y - point->y));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void AdScene::pfOpenListPush(AdPathPoint *point) {
+	PathFinderNode node;
+	node._estimate = point->_distance + pfEstimate(point);
+	node._point = point;
+
+	uint32 pos = _pfOpenList.size();
+	_pfOpenList.push_back(node);
+	while (pos > 0) {
+		uint32 parent = (pos - 1) / 2;
+		if (_pfOpenList[parent]._estimate <= node._estimate) {
+			break;
+		}
+		_pfOpenList[pos] = _pfOpenList[parent];
+		pos = parent;
+	}
+	_pfOpenList[pos] = node;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+AdPathPoint *AdScene::pfOpenListPop() {
+	// the open list isn't saved, rebuild it when continuing a search from a saved game
+	if (_pfOpenList.empty()) {
+		for (int32 i = 0; i < _pfPointsNum; i++) {
+			if (!_pfPath[i]->_marked && _pfPath[i]->_distance != INT_MAX) {
+				pfOpenListPush(_pfPath[i]);
 			}
 		}
+	}
+
+	while (!_pfOpenList.empty()) {
+		PathFinderNode top = _pfOpenList[0];
+
+		PathFinderNode last = _pfOpenList.back();
+		_pfOpenList.pop_back();
+		uint32 size = _pfOpenList.size();
+		if (size > 0) {
+			uint32 pos = 0;
+			for (;;) {
+				uint32 child = pos * 2 + 1;
+				if (child >= size) {
+					break;
+				}
+				if (child + 1 < size && _pfOpenList[child + 1]._estimate < _pfOpenList[child]._estimate) {
+					child++;
+				}
+				if (last._estimate <= _pfOpenList[child]._estimate) {
+					break;
+				}
+				_pfOpenList[pos] = _pfOpenList[child];
+				pos = child;
+			}
+			_pfOpenList[pos] = last;
+		}
+
+		// skip points that were already reached by a shorter path
+		if (!top._point->_marked && top._estimate == top._point->_distance + pfEstimate(top._point)) {
+			return top._point;
+		}
+	}
+
+	return nullptr;
 }
 
 
@@ -527,8 +725,15 @@ bool AdScene::initLoop() {
 	}
 #else
 	uint32 start = _gameRef->_currentTime;
-	while (!_pfReady && g_system->getMillis() - start <= _pfMaxTime) {
-		pathFinderStep();
+	if (!_pfReady) {
+		uint32 stepStart = g_system->getMillis();
+		while (!_pfReady && g_system->getMillis() - start <= _pfMaxTime) {
+			pathFinderStep();
+		}
+
+		uint32 stepTime = g_system->getMillis() - stepStart;
+		_pfStats._totalTime += stepTime;
+		_pfStats._maxFrameTime = MAX(_pfStats._maxFrameTime, stepTime);
 	}
 #endif
 
@@ -2511,6 +2716,7 @@ bool AdScene::correctTargetPoint(int32 startX, int32 startY, int32 *argX, int32
 //////////////////////////////////////////////////////////////////////////
 void AdScene::pfPointsStart() {
 	_pfPointsNum = 0;
+	_pfOpenList.clear();
 }
 
 
@@ -2526,6 +2732,10 @@ void AdScene::pfPointsAdd(int x, int y, int distance) {
 		_pfPath[_pfPointsNum]->_origin = nullptr;
 	}
 
+	if (distance != INT_MAX) {
+		pfOpenListPush(_pfPath[_pfPointsNum]);
+	}
+
 	_pfPointsNum++;
 }
 
@@ -30,6 +30,8 @@
 #define WINTERMUTE_ADSCENE_H
 
 #include "engines/wintermute/base/base_fader.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 
 namespace Wintermute {
 
@@ -155,6 +157,22 @@ public:
 	virtual bool restoreDeviceObjects();
 	int getPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject *requester = nullptr);
 
+	// path finder statistics, shown by the pathfinder_stats console command
+	struct PathFinderStats {
+		uint32 _searches;
+		uint32 _steps;
+		uint32 _segmentChecks;
+		uint32 _cacheHits;
+		uint32 _totalTime;
+		uint32 _maxFrameTime;
+
+		PathFinderStats() { reset(); }
+		void reset() {
+			_searches = _steps = _segmentChecks = _cacheHits = _totalTime = _maxFrameTime = 0;
+		}
+	};
+	PathFinderStats _pfStats;
+
 	// scripting interface
 	virtual ScValue *scGetProperty(const Common::String &name) override;
 	virtual bool scSetProperty(const char *name, ScValue *value) override;
@@ -171,6 +189,39 @@ private:
 	BaseObject *_pfRequester;
 	BaseArray<AdPathPoint *> _pfPath;
 
+	// A* open list, a binary heap ordered by estimated total distance.
+	// Entries of points that got a shorter distance later are skipped when popped.
+	struct PathFinderNode {
+		int32 _estimate;
+		AdPathPoint *_point;
+	};
+	Common::Array<PathFinderNode> _pfOpenList;
+	void pfOpenListPush(AdPathPoint *point);
+	AdPathPoint *pfOpenListPop();
+	int pfEstimate(const AdPathPoint *point) const;
+
+	// Line of sight between two waypoints through the main layer regions, keyed
+	// by both points. Free object block regions move, they are checked separately.
+	// Start and target points differ for every search and are never cached.
+	struct VisibilityKeyHash {
+		uint operator()(uint64 key) const {
+			return (uint)(key ^ (key >> 32));
+		}
+	};
+	Common::HashMap<uint64, bool, VisibilityKeyHash> _pfVisibility;
+	// Main layer regions the cached lines of sight were traced against
+	struct PathFinderRegionState {
+		AdRegion *_region;
+		uint32 _version;
+		bool _active;
+	};
+	Common::Array<PathFinderRegionState> _pfBlockingState;
+	bool updateBlockingState();
+	int getCachedPointsDist(const BasePoint &p1, const BasePoint &p2, BaseObject *requester);
+	bool isSegmentBlocked(const BasePoint &p1, const BasePoint &p2, bool checkLayer, bool checkFreeObjects, BaseObject *requester);
+	bool isBlockedByFreeObjectAt(int x, int y, BaseObject *requester);
+	bool hasFreeBlockers(BaseObject *requester);
+
 	int32 _offsetTop;
 	int32 _offsetLeft;
 
@@ -79,9 +79,161 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(BaseGame, true)
 
+// Methods handled by BaseGame::scCallMethod(), in the order of their names below
+enum {
+	kGameMethodLOG = 0,
+	kGameMethodCaption,
+	kGameMethodMsg,
+	kGameMethodRunScript,
+	kGameMethodLoadStringTable,
+	kGameMethodValidObject,
+	kGameMethodReset,
+	kGameMethodUnloadObject,
+	kGameMethodLoadWindow,
+	kGameMethodExpandString,
+	kGameMethodSetMousePos,
+	kGameMethodLockMouseRect,
+	kGameMethodPlayVideo,
+	kGameMethodPlayTheora,
+	kGameMethodQuitGame,
+	kGameMethodRegWriteNumber,
+	kGameMethodRegReadNumber,
+	kGameMethodRegWriteString,
+	kGameMethodRegReadString,
+	kGameMethodSaveGame,
+	kGameMethodLoadGame,
+	kGameMethodIsSaveSlotUsed,
+	kGameMethodGetSaveSlotDescription,
+	kGameMethodEmptySaveSlot,
+	kGameMethodSetGlobalSFXVolume,
+	kGameMethodSetGlobalSpeechVolume,
+	kGameMethodSetGlobalMusicVolume,
+	kGameMethodSetGlobalMasterVolume,
+	kGameMethodGetGlobalSFXVolume,
+	kGameMethodGetGlobalSpeechVolume,
+	kGameMethodGetGlobalMusicVolume,
+	kGameMethodGetGlobalMasterVolume,
+	kGameMethodSetActiveCursor,
+	kGameMethodGetActiveCursor,
+	kGameMethodGetActiveCursorObject,
+	kGameMethodRemoveActiveCursor,
+	kGameMethodHasActiveCursor,
+	kGameMethodFileExists,
+	kGameMethodFadeOut,
+	kGameMethodFadeOutAsync,
+	kGameMethodSystemFadeOut,
+	kGameMethodSystemFadeOutAsync,
+	kGameMethodFadeIn,
+	kGameMethodFadeInAsync,
+	kGameMethodSystemFadeIn,
+	kGameMethodSystemFadeInAsync,
+	kGameMethodGetFadeColor,
+	kGameMethodScreenshot,
+	kGameMethodScreenshotEx,
+	kGameMethodCreateWindow,
+	kGameMethodDeleteWindow,
+	kGameMethodOpenDocument,
+	kGameMethodDEBUG_DumpClassRegistry,
+	kGameMethodSetLoadingScreen,
+	kGameMethodSetSavingScreen,
+	kGameMethodSetWaitCursor,
+	kGameMethodRemoveWaitCursor,
+	kGameMethodGetWaitCursor,
+	kGameMethodGetWaitCursorObject,
+	kGameMethodClearScriptCache,
+	kGameMethodDisplayLoadingIcon,
+	kGameMethodHideLoadingIcon,
+	kGameMethodDumpTextureStats,
+	kGameMethodAccOutputText,
+	kGameMethodStoreSaveThumbnail,
+	kGameMethodDeleteSaveThumbnail,
+	kGameMethodGetFileChecksum,
+	kGameMethodEnableScriptProfiling,
+	kGameMethodDisableScriptProfiling,
+	kGameMethodShowStatusLine,
+	kGameMethodHideStatusLine,
+};
+
+static const char *const gameMethodNames[] = {
+	"LOG",
+	"Caption",
+	"Msg",
+	"RunScript",
+	"LoadStringTable",
+	"ValidObject",
+	"Reset",
+	"UnloadObject",
+	"LoadWindow",
+	"ExpandString",
+	"SetMousePos",
+	"LockMouseRect",
+	"PlayVideo",
+	"PlayTheora",
+	"QuitGame",
+	"RegWriteNumber",
+	"RegReadNumber",
+	"RegWriteString",
+	"RegReadString",
+	"SaveGame",
+	"LoadGame",
+	"IsSaveSlotUsed",
+	"GetSaveSlotDescription",
+	"EmptySaveSlot",
+	"SetGlobalSFXVolume",
+	"SetGlobalSpeechVolume",
+	"SetGlobalMusicVolume",
+	"SetGlobalMasterVolume",
+	"GetGlobalSFXVolume",
+	"GetGlobalSpeechVolume",
+	"GetGlobalMusicVolume",
+	"GetGlobalMasterVolume",
+	"SetActiveCursor",
+	"GetActiveCursor",
+	"GetActiveCursorObject",
+	"RemoveActiveCursor",
+	"HasActiveCursor",
+	"FileExists",
+	"FadeOut",
+	"FadeOutAsync",
+	"SystemFadeOut",
+	"SystemFadeOutAsync",
+	"FadeIn",
+	"FadeInAsync",
+	"SystemFadeIn",
+	"SystemFadeInAsync",
+	"GetFadeColor",
+	"Screenshot",
+	"ScreenshotEx",
+	"CreateWindow",
+	"DeleteWindow",
+	"OpenDocument",
+	"DEBUG_DumpClassRegistry",
+	"SetLoadingScreen",
+	"SetSavingScreen",
+	"SetWaitCursor",
+	"RemoveWaitCursor",
+	"GetWaitCursor",
+	"GetWaitCursorObject",
+	"ClearScriptCache",
+	"DisplayLoadingIcon",
+	"HideLoadingIcon",
+	"DumpTextureStats",
+	"AccOutputText",
+	"StoreSaveThumbnail",
+	"DeleteSaveThumbnail",
+	"GetFileChecksum",
+	"EnableScriptProfiling",
+	"DisableScriptProfiling",
+	"ShowStatusLine",
+	"HideStatusLine",
+};
+
 
 //////////////////////////////////////////////////////////////////////
 BaseGame::BaseGame(const Common::String &targetName) : BaseObject(this), _targetName(targetName), _timerNormal(), _timerLive() {
+	_methodTable.init(gameMethodNames, ARRAYSIZE(gameMethodNames));
+	BaseObject::initMethodTable(_objectMethodTable);
+
 	_shuttingDown = false;
 
 	_state = GAME_RUNNING;
@@ -938,10 +1090,19 @@ bool BaseGame::loadBuffer(char *buffer, bool complete) {
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	int method = _methodTable.getId(name);
+	if (method < 0) {
+		// none of the music system's methods are handled here
+		if (_musicSystem->scCallMethod(script, stack, thisStack, name) == STATUS_OK) {
+			return STATUS_OK;
+		}
+		return BaseObject::scCallMethod(script, stack, thisStack, name);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// LOG
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "LOG") == 0) {
+	if (method == kGameMethodLOG) {
 		stack->correctParams(1);
 		LOG(0, stack->pop()->getString());
 		stack->pushNULL();
@@ -951,7 +1112,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Caption") == 0) {
+	else if (method == kGameMethodCaption) {
 		bool res = BaseObject::scCallMethod(script, stack, thisStack, name);
 		setWindowTitle();
 		return res;
@@ -960,7 +1121,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Msg
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Msg") == 0) {
+	else if (method == kGameMethodMsg) {
 		stack->correctParams(1);
 		quickMessage(stack->pop()->getString());
 		stack->pushNULL();
@@ -970,7 +1131,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RunScript
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RunScript") == 0) {
+	else if (method == kGameMethodRunScript) {
 		_gameRef->LOG(0, "**Warning** The 'RunScript' method is now obsolete. Use 'AttachScript' instead (same syntax)");
 		stack->correctParams(1);
 		if (DID_FAIL(addScript(stack->pop()->getString()))) {
@@ -985,7 +1146,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadStringTable
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadStringTable") == 0) {
+	else if (method == kGameMethodLoadStringTable) {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		ScValue *val = stack->pop();
@@ -1009,7 +1170,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ValidObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ValidObject") == 0) {
+	else if (method == kGameMethodValidObject) {
 		stack->correctParams(1);
 		BaseScriptable *obj = stack->pop()->getNative();
 		if (validObject((BaseObject *) obj)) {
@@ -1024,7 +1185,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Reset
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Reset") == 0) {
+	else if (method == kGameMethodReset) {
 		stack->correctParams(0);
 		resetContent();
 		stack->pushNULL();
@@ -1036,7 +1197,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// UnloadObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "UnloadObject") == 0) {
+	else if (method == kGameMethodUnloadObject) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		BaseObject *obj = (BaseObject *)val->getNative();
@@ -1052,7 +1213,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadWindow") == 0) {
+	else if (method == kGameMethodLoadWindow) {
 		stack->correctParams(1);
 		UIWindow *win = new UIWindow(_gameRef);
 		if (win && DID_SUCCEED(win->loadFile(stack->pop()->getString()))) {
@@ -1070,7 +1231,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ExpandString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ExpandString") == 0) {
+	else if (method == kGameMethodExpandString) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 		char *str = new char[strlen(val->getString()) + 1];
@@ -1081,14 +1242,10 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 		return STATUS_OK;
 	}
 
-	else if (_musicSystem->scCallMethod(script, stack, thisStack, name) == STATUS_OK) {
-		return STATUS_OK;
-	}
-
 	//////////////////////////////////////////////////////////////////////////
 	// SetMousePos
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetMousePos") == 0) {
+	else if (method == kGameMethodSetMousePos) {
 		stack->correctParams(2);
 		int32 x = stack->pop()->getInt();
 		int32 y = stack->pop()->getInt();
@@ -1109,7 +1266,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LockMouseRect
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LockMouseRect") == 0) {
+	else if (method == kGameMethodLockMouseRect) {
 		stack->correctParams(4);
 		int left = stack->pop()->getInt();
 		int top = stack->pop()->getInt();
@@ -1132,7 +1289,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PlayVideo
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayVideo") == 0) {
+	else if (method == kGameMethodPlayVideo) {
 		_gameRef->LOG(0, "Warning: Game.PlayVideo() is now deprecated. Use Game.PlayTheora() instead.");
 
 		stack->correctParams(6);
@@ -1174,7 +1331,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// PlayTheora
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlayTheora") == 0) {
+	else if (method == kGameMethodPlayTheora) {
 		stack->correctParams(7);
 		const char *filename = stack->pop()->getString();
 		ScValue *valType = stack->pop();
@@ -1219,7 +1376,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// QuitGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "QuitGame") == 0) {
+	else if (method == kGameMethodQuitGame) {
 		stack->correctParams(0);
 		stack->pushNULL();
 		_quitting = true;
@@ -1229,7 +1386,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegWriteNumber
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegWriteNumber") == 0) {
+	else if (method == kGameMethodRegWriteNumber) {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		int val = stack->pop()->getInt();
@@ -1242,7 +1399,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegReadNumber
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegReadNumber") == 0) {
+	else if (method == kGameMethodRegReadNumber) {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		int initVal = stack->pop()->getInt();
@@ -1258,7 +1415,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegWriteString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegWriteString") == 0) {
+	else if (method == kGameMethodRegWriteString) {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		const char *val = stack->pop()->getString();
@@ -1272,7 +1429,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RegReadString
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RegReadString") == 0) {
+	else if (method == kGameMethodRegReadString) {
 		stack->correctParams(2);
 		const char *key = stack->pop()->getString();
 		const char *initVal = stack->pop()->getString();
@@ -1284,7 +1441,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SaveGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SaveGame") == 0) {
+	else if (method == kGameMethodSaveGame) {
 		stack->correctParams(3);
 		int slot = stack->pop()->getInt();
 		const char *xdesc = stack->pop()->getString();
@@ -1304,7 +1461,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// LoadGame
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadGame") == 0) {
+	else if (method == kGameMethodLoadGame) {
 		stack->correctParams(1);
 		_scheduledLoadSlot = stack->pop()->getInt();
 		_loading = true;
@@ -1316,7 +1473,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// IsSaveSlotUsed
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsSaveSlotUsed") == 0) {
+	else if (method == kGameMethodIsSaveSlotUsed) {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		stack->pushBool(SaveLoad::isSaveSlotUsed(slot));
@@ -1326,7 +1483,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetSaveSlotDescription
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSaveSlotDescription") == 0) {
+	else if (method == kGameMethodGetSaveSlotDescription) {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		char desc[512];
@@ -1339,7 +1496,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// EmptySaveSlot
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EmptySaveSlot") == 0) {
+	else if (method == kGameMethodEmptySaveSlot) {
 		stack->correctParams(1);
 		int slot = stack->pop()->getInt();
 		SaveLoad::emptySaveSlot(slot);
@@ -1350,7 +1507,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalSFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalSFXVolume") == 0) {
+	else if (method == kGameMethodSetGlobalSFXVolume) {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSFXSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1360,7 +1517,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalSpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalSpeechVolume") == 0) {
+	else if (method == kGameMethodSetGlobalSpeechVolume) {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kSpeechSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1370,7 +1527,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalMusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalMusicVolume") == 0) {
+	else if (method == kGameMethodSetGlobalMusicVolume) {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setVolumePercent(Audio::Mixer::kMusicSoundType, (byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1380,7 +1537,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetGlobalMasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetGlobalMasterVolume") == 0) {
+	else if (method == kGameMethodSetGlobalMasterVolume) {
 		stack->correctParams(1);
 		_gameRef->_soundMgr->setMasterVolumePercent((byte)stack->pop()->getInt());
 		stack->pushNULL();
@@ -1390,7 +1547,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalSFXVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalSFXVolume") == 0) {
+	else if (method == kGameMethodGetGlobalSFXVolume) {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kSFXSoundType));
 		return STATUS_OK;
@@ -1399,7 +1556,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalSpeechVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalSpeechVolume") == 0) {
+	else if (method == kGameMethodGetGlobalSpeechVolume) {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kSpeechSoundType));
 		return STATUS_OK;
@@ -1408,7 +1565,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalMusicVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalMusicVolume") == 0) {
+	else if (method == kGameMethodGetGlobalMusicVolume) {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getVolumePercent(Audio::Mixer::kMusicSoundType));
 		return STATUS_OK;
@@ -1417,7 +1574,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetGlobalMasterVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetGlobalMasterVolume") == 0) {
+	else if (method == kGameMethodGetGlobalMasterVolume) {
 		stack->correctParams(0);
 		stack->pushInt(_soundMgr->getMasterVolumePercent());
 		return STATUS_OK;
@@ -1426,7 +1583,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetActiveCursor") == 0) {
+	else if (method == kGameMethodSetActiveCursor) {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setActiveCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -1440,7 +1597,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetActiveCursor") == 0) {
+	else if (method == kGameMethodGetActiveCursor) {
 		stack->correctParams(0);
 		if (!_activeCursor || !_activeCursor->getFilename()) {
 			stack->pushNULL();
@@ -1454,7 +1611,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetActiveCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetActiveCursorObject") == 0) {
+	else if (method == kGameMethodGetActiveCursorObject) {
 		stack->correctParams(0);
 		if (!_activeCursor) {
 			stack->pushNULL();
@@ -1468,7 +1625,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveActiveCursor") == 0) {
+	else if (method == kGameMethodRemoveActiveCursor) {
 		stack->correctParams(0);
 		delete _activeCursor;
 		_activeCursor = nullptr;
@@ -1480,7 +1637,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HasActiveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasActiveCursor") == 0) {
+	else if (method == kGameMethodHasActiveCursor) {
 		stack->correctParams(0);
 
 		if (_activeCursor) {
@@ -1495,7 +1652,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FileExists
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FileExists") == 0) {
+	else if (method == kGameMethodFileExists) {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -1507,7 +1664,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FadeOut / FadeOutAsync / SystemFadeOut / SystemFadeOutAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeOut") == 0 || strcmp(name, "FadeOutAsync") == 0 || strcmp(name, "SystemFadeOut") == 0 || strcmp(name, "SystemFadeOutAsync") == 0) {
+	else if (method == kGameMethodFadeOut || method == kGameMethodFadeOutAsync || method == kGameMethodSystemFadeOut || method == kGameMethodSystemFadeOutAsync) {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1529,7 +1686,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// FadeIn / FadeInAsync / SystemFadeIn / SystemFadeInAsync
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "FadeIn") == 0 || strcmp(name, "FadeInAsync") == 0 || strcmp(name, "SystemFadeIn") == 0 || strcmp(name, "SystemFadeInAsync") == 0) {
+	else if (method == kGameMethodFadeIn || method == kGameMethodFadeInAsync || method == kGameMethodSystemFadeIn || method == kGameMethodSystemFadeInAsync) {
 		stack->correctParams(5);
 		uint32 duration = stack->pop()->getInt(500);
 		byte red = stack->pop()->getInt(0);
@@ -1551,7 +1708,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFadeColor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFadeColor") == 0) {
+	else if (method == kGameMethodGetFadeColor) {
 		stack->correctParams(0);
 		stack->pushInt(_fader->getCurrentColor());
 		return STATUS_OK;
@@ -1560,7 +1717,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// Screenshot
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Screenshot") == 0) {
+	else if (method == kGameMethodScreenshot) {
 		stack->correctParams(1);
 		char filename[MAX_PATH_LENGTH];
 
@@ -1586,7 +1743,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ScreenshotEx
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ScreenshotEx") == 0) {
+	else if (method == kGameMethodScreenshotEx) {
 		stack->correctParams(3);
 		const char *filename = stack->pop()->getString();
 		int sizeX = stack->pop()->getInt(_renderer->getWidth());
@@ -1601,7 +1758,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// CreateWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "CreateWindow") == 0) {
+	else if (method == kGameMethodCreateWindow) {
 		stack->correctParams(1);
 		ScValue *val = stack->pop();
 
@@ -1618,7 +1775,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteWindow
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteWindow") == 0) {
+	else if (method == kGameMethodDeleteWindow) {
 		stack->correctParams(1);
 		BaseObject *obj = (BaseObject *)stack->pop()->getNative();
 		for (uint32 i = 0; i < _windows.size(); i++) {
@@ -1635,7 +1792,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// OpenDocument
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "OpenDocument") == 0) {
+	else if (method == kGameMethodOpenDocument) {
 		stack->correctParams(0);
 		stack->pushNULL();
 		return STATUS_OK;
@@ -1644,7 +1801,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DEBUG_DumpClassRegistry
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DEBUG_DumpClassRegistry") == 0) {
+	else if (method == kGameMethodDEBUG_DumpClassRegistry) {
 		stack->correctParams(0);
 		DEBUG_DumpClassRegistry();
 		stack->pushNULL();
@@ -1654,7 +1811,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetLoadingScreen
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetLoadingScreen") == 0) {
+	else if (method == kGameMethodSetLoadingScreen) {
 		stack->correctParams(3);
 		ScValue *val = stack->pop();
 		int loadImageX = stack->pop()->getInt();
@@ -1672,7 +1829,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetSavingScreen
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSavingScreen") == 0) {
+	else if (method == kGameMethodSetSavingScreen) {
 		stack->correctParams(3);
 		ScValue *val = stack->pop();
 		int saveImageX = stack->pop()->getInt();
@@ -1690,7 +1847,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// SetWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetWaitCursor") == 0) {
+	else if (method == kGameMethodSetWaitCursor) {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setWaitCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -1704,7 +1861,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveWaitCursor") == 0) {
+	else if (method == kGameMethodRemoveWaitCursor) {
 		stack->correctParams(0);
 		delete _cursorNoninteractive;
 		_cursorNoninteractive = nullptr;
@@ -1717,7 +1874,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetWaitCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWaitCursor") == 0) {
+	else if (method == kGameMethodGetWaitCursor) {
 		stack->correctParams(0);
 		if (!_cursorNoninteractive || !_cursorNoninteractive->getFilename()) {
 			stack->pushNULL();
@@ -1731,7 +1888,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetWaitCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetWaitCursorObject") == 0) {
+	else if (method == kGameMethodGetWaitCursorObject) {
 		stack->correctParams(0);
 		if (!_cursorNoninteractive) {
 			stack->pushNULL();
@@ -1745,7 +1902,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ClearScriptCache
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ClearScriptCache") == 0) {
+	else if (method == kGameMethodClearScriptCache) {
 		stack->correctParams(0);
 		stack->pushBool(DID_SUCCEED(_scEngine->emptyScriptCache()));
 		return STATUS_OK;
@@ -1754,7 +1911,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DisplayLoadingIcon
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisplayLoadingIcon") == 0) {
+	else if (method == kGameMethodDisplayLoadingIcon) {
 		stack->correctParams(4);
 
 		const char *filename = stack->pop()->getString();
@@ -1780,7 +1937,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HideLoadingIcon
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HideLoadingIcon") == 0) {
+	else if (method == kGameMethodHideLoadingIcon) {
 		stack->correctParams(0);
 		delete _loadingIcon;
 		_loadingIcon = nullptr;
@@ -1791,7 +1948,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DumpTextureStats
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DumpTextureStats") == 0) {
+	else if (method == kGameMethodDumpTextureStats) {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 
@@ -1804,7 +1961,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// AccOutputText
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "AccOutputText") == 0) {
+	else if (method == kGameMethodAccOutputText) {
 		stack->correctParams(2);
 		/* const char *str = */	stack->pop()->getString();
 		/* int type = */ stack->pop()->getInt();
@@ -1817,7 +1974,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// StoreSaveThumbnail
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StoreSaveThumbnail") == 0) {
+	else if (method == kGameMethodStoreSaveThumbnail) {
 		stack->correctParams(0);
 		delete _cachedThumbnail;
 		_cachedThumbnail = new SaveThumbHelper(this);
@@ -1835,7 +1992,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DeleteSaveThumbnail
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DeleteSaveThumbnail") == 0) {
+	else if (method == kGameMethodDeleteSaveThumbnail) {
 		stack->correctParams(0);
 		delete _cachedThumbnail;
 		_cachedThumbnail = nullptr;
@@ -1847,7 +2004,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// GetFileChecksum
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetFileChecksum") == 0) {
+	else if (method == kGameMethodGetFileChecksum) {
 		stack->correctParams(2);
 		const char *filename = stack->pop()->getString();
 		bool asHex = stack->pop()->getBool(false);
@@ -1888,7 +2045,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// EnableScriptProfiling
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "EnableScriptProfiling") == 0) {
+	else if (method == kGameMethodEnableScriptProfiling) {
 		stack->correctParams(0);
 		_scEngine->enableProfiling();
 		stack->pushNULL();
@@ -1899,7 +2056,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// DisableScriptProfiling
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "DisableScriptProfiling") == 0) {
+	else if (method == kGameMethodDisableScriptProfiling) {
 		stack->correctParams(0);
 		_scEngine->disableProfiling();
 		stack->pushNULL();
@@ -1910,7 +2067,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// ShowStatusLine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ShowStatusLine") == 0) {
+	else if (method == kGameMethodShowStatusLine) {
 		stack->correctParams(0);
 		// Block kept to show intention of opcode.
 		/*#ifdef __IPHONEOS__
@@ -1924,7 +2081,7 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 	//////////////////////////////////////////////////////////////////////////
 	// HideStatusLine
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HideStatusLine") == 0) {
+	else if (method == kGameMethodHideStatusLine) {
 		stack->correctParams(0);
 		// Block kept to show intention of opcode.
 		/*#ifdef __IPHONEOS__
@@ -1941,6 +2098,10 @@ bool BaseGame::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *BaseGame::scGetProperty(const Common::String &name) {
+	if (_passOnNames._getProperties.contains(name)) {
+		return BaseObject::scGetProperty(name);
+	}
+
 	_scValue->setNULL();
 
 	//////////////////////////////////////////////////////////////////////////
@@ -2332,6 +2493,7 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 
 		return _scValue;
 	} else {
+		_passOnNames._getProperties.setVal(name, true);
 		return BaseObject::scGetProperty(name);
 	}
 }
@@ -2339,6 +2501,10 @@ ScValue *BaseGame::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseGame::scSetProperty(const char *name, ScValue *value) {
+	if (_passOnNames._setProperties.contains(name)) {
+		return BaseObject::scSetProperty(name, value);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Name
 	//////////////////////////////////////////////////////////////////////////
@@ -2533,6 +2699,7 @@ bool BaseGame::scSetProperty(const char *name, ScValue *value) {
 		_cursorHidden = value->getBool();
 		return STATUS_OK;
 	} else {
+		_passOnNames._setProperties.setVal(name, true);
 		return BaseObject::scSetProperty(name, value);
 	}
 }
@@ -255,6 +255,10 @@ public:
 	bool _constrainedMemory;
 
 	bool stopVideo();
+
+	// Names passed on and method IDs of the scripting interface of BaseObject, shared by all objects
+	ScPassOnNames _objectPassOnNames;
+	ScNameTable _objectMethodTable;
 protected:
 	BaseFont *_systemFont;
 	BaseFont *_videoFont;
@@ -322,6 +326,9 @@ private:
 	uint32 _fps;
 	BaseGameMusic *_musicSystem;
 
+	ScPassOnNames _passOnNames;
+	ScNameTable _methodTable;
+
 	bool isVideoPlaying();
 
 	BaseArray<BaseQuickMsg *> _quickMessages;
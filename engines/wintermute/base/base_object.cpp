@@ -40,6 +40,57 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(BaseObject, false)
 
+// Methods handled by BaseObject::scCallMethod(), in the order of their names below
+enum {
+	kObjectMethodSkipTo = 0,
+	kObjectMethodCaption,
+	kObjectMethodSetCursor,
+	kObjectMethodRemoveCursor,
+	kObjectMethodGetCursor,
+	kObjectMethodGetCursorObject,
+	kObjectMethodHasCursor,
+	kObjectMethodSetCaption,
+	kObjectMethodLoadSound,
+	kObjectMethodPlaySound,
+	kObjectMethodPlaySoundEvent,
+	kObjectMethodStopSound,
+	kObjectMethodPauseSound,
+	kObjectMethodResumeSound,
+	kObjectMethodIsSoundPlaying,
+	kObjectMethodSetSoundPosition,
+	kObjectMethodGetSoundPosition,
+	kObjectMethodSetSoundVolume,
+	kObjectMethodGetSoundVolume,
+	kObjectMethodSoundFXNone,
+	kObjectMethodSoundFXEcho,
+	kObjectMethodSoundFXReverb,
+};
+
+static const char *const objectMethodNames[] = {
+	"SkipTo",
+	"Caption",
+	"SetCursor",
+	"RemoveCursor",
+	"GetCursor",
+	"GetCursorObject",
+	"HasCursor",
+	"SetCaption",
+	"LoadSound",
+	"PlaySound",
+	"PlaySoundEvent",
+	"StopSound",
+	"PauseSound",
+	"ResumeSound",
+	"IsSoundPlaying",
+	"SetSoundPosition",
+	"GetSoundPosition",
+	"SetSoundVolume",
+	"GetSoundVolume",
+	"SoundFXNone",
+	"SoundFXEcho",
+	"SoundFXReverb",
+};
+
 //////////////////////////////////////////////////////////////////////
 BaseObject::BaseObject(BaseGame *inGame) : BaseScriptHolder(inGame) {
 	_posX = _posY = 0;
@@ -173,15 +224,25 @@ bool BaseObject::listen(BaseScriptHolder *param1, uint32 param2) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void BaseObject::initMethodTable(ScNameTable &table) {
+	table.init(objectMethodNames, ARRAYSIZE(objectMethodNames));
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 // high level scripting interface
 //////////////////////////////////////////////////////////////////////////
 bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) {
+	int method = _gameRef->_objectMethodTable.getId(name);
+	if (method < 0) {
+		return BaseScriptHolder::scCallMethod(script, stack, thisStack, name);
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// SkipTo
 	//////////////////////////////////////////////////////////////////////////
-	if (strcmp(name, "SkipTo") == 0) {
+	if (method == kObjectMethodSkipTo) {
 		stack->correctParams(2);
 		_posX = stack->pop()->getInt();
 		_posY = stack->pop()->getInt();
@@ -194,7 +255,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "Caption") == 0) {
+	else if (method == kObjectMethodCaption) {
 		stack->correctParams(1);
 		stack->pushString(getCaption(stack->pop()->getInt()));
 
@@ -204,7 +265,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetCursor") == 0) {
+	else if (method == kObjectMethodSetCursor) {
 		stack->correctParams(1);
 		if (DID_SUCCEED(setCursor(stack->pop()->getString()))) {
 			stack->pushBool(true);
@@ -218,7 +279,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// RemoveCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "RemoveCursor") == 0) {
+	else if (method == kObjectMethodRemoveCursor) {
 		stack->correctParams(0);
 		if (!_sharedCursors) {
 			delete _cursor;
@@ -235,7 +296,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCursor") == 0) {
+	else if (method == kObjectMethodGetCursor) {
 		stack->correctParams(0);
 		if (!_cursor || !_cursor->getFilename()) {
 			stack->pushNULL();
@@ -249,7 +310,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetCursorObject
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetCursorObject") == 0) {
+	else if (method == kObjectMethodGetCursorObject) {
 		stack->correctParams(0);
 		if (!_cursor) {
 			stack->pushNULL();
@@ -263,7 +324,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// HasCursor
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "HasCursor") == 0) {
+	else if (method == kObjectMethodHasCursor) {
 		stack->correctParams(0);
 
 		if (_cursor) {
@@ -278,7 +339,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetCaption
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetCaption") == 0) {
+	else if (method == kObjectMethodSetCaption) {
 		stack->correctParams(2);
 		setCaption(stack->pop()->getString(), stack->pop()->getInt());
 		stack->pushNULL();
@@ -289,7 +350,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// LoadSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "LoadSound") == 0) {
+	else if (method == kObjectMethodLoadSound) {
 		stack->correctParams(1);
 		const char *filename = stack->pop()->getString();
 		if (DID_SUCCEED(playSFX(filename, false, false))) {
@@ -304,7 +365,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PlaySound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlaySound") == 0) {
+	else if (method == kObjectMethodPlaySound) {
 		stack->correctParams(3);
 
 		const char *filename;
@@ -340,7 +401,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PlaySoundEvent
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PlaySoundEvent") == 0) {
+	else if (method == kObjectMethodPlaySoundEvent) {
 		stack->correctParams(2);
 
 		const char *filename;
@@ -368,7 +429,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// StopSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "StopSound") == 0) {
+	else if (method == kObjectMethodStopSound) {
 		stack->correctParams(0);
 
 		if (DID_FAIL(stopSFX())) {
@@ -382,7 +443,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// PauseSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "PauseSound") == 0) {
+	else if (method == kObjectMethodPauseSound) {
 		stack->correctParams(0);
 
 		if (DID_FAIL(pauseSFX())) {
@@ -396,7 +457,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// ResumeSound
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "ResumeSound") == 0) {
+	else if (method == kObjectMethodResumeSound) {
 		stack->correctParams(0);
 
 		if (DID_FAIL(resumeSFX())) {
@@ -410,7 +471,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// IsSoundPlaying
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "IsSoundPlaying") == 0) {
+	else if (method == kObjectMethodIsSoundPlaying) {
 		stack->correctParams(0);
 
 		if (_sFX && _sFX->isPlaying()) {
@@ -424,7 +485,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetSoundPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSoundPosition") == 0) {
+	else if (method == kObjectMethodSetSoundPosition) {
 		stack->correctParams(1);
 
 		uint32 time = stack->pop()->getInt();
@@ -439,7 +500,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetSoundPosition
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundPosition") == 0) {
+	else if (method == kObjectMethodGetSoundPosition) {
 		stack->correctParams(0);
 
 		if (!_sFX) {
@@ -453,7 +514,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SetSoundVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SetSoundVolume") == 0) {
+	else if (method == kObjectMethodSetSoundVolume) {
 		stack->correctParams(1);
 
 		int volume = stack->pop()->getInt();
@@ -468,7 +529,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// GetSoundVolume
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "GetSoundVolume") == 0) {
+	else if (method == kObjectMethodGetSoundVolume) {
 		stack->correctParams(0);
 
 		if (!_sFX) {
@@ -483,7 +544,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXNone
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXNone") == 0) {
+	else if (method == kObjectMethodSoundFXNone) {
 		stack->correctParams(0);
 		_sFXType = SFX_NONE;
 		_sFXParam1 = 0;
@@ -498,7 +559,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXEcho
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXEcho") == 0) {
+	else if (method == kObjectMethodSoundFXEcho) {
 		stack->correctParams(4);
 		_sFXType = SFX_ECHO;
 		_sFXParam1 = (float)stack->pop()->getFloat(0); // Wet/Dry Mix [%] (0-100)
@@ -513,7 +574,7 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 	//////////////////////////////////////////////////////////////////////////
 	// SoundFXReverb
 	//////////////////////////////////////////////////////////////////////////
-	else if (strcmp(name, "SoundFXReverb") == 0) {
+	else if (method == kObjectMethodSoundFXReverb) {
 		stack->correctParams(4);
 		_sFXType = SFX_REVERB;
 		_sFXParam1 = (float)stack->pop()->getFloat(0); // In Gain [dB] (-96 - 0)
@@ -531,6 +592,10 @@ bool BaseObject::scCallMethod(ScScript *script, ScStack *stack, ScStack *thisSta
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *BaseObject::scGetProperty(const Common::String &name) {
+	if (_gameRef->_objectPassOnNames._getProperties.contains(name)) {
+		return BaseScriptHolder::scGetProperty(name);
+	}
+
 	_scValue->setNULL();
 
 	//////////////////////////////////////////////////////////////////////////
@@ -729,6 +794,7 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 		_scValue->setNULL();
 		return _scValue;
 	} else {
+		_gameRef->_objectPassOnNames._getProperties.setVal(name, true);
 		return BaseScriptHolder::scGetProperty(name);
 	}
 }
@@ -736,6 +802,10 @@ ScValue *BaseObject::scGetProperty(const Common::String &name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseObject::scSetProperty(const char *name, ScValue *value) {
+	if (_gameRef->_objectPassOnNames._setProperties.contains(name)) {
+		return BaseScriptHolder::scSetProperty(name, value);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Caption
 	//////////////////////////////////////////////////////////////////////////
@@ -921,6 +991,7 @@ bool BaseObject::scSetProperty(const char *name, ScValue *value) {
 	else if (strcmp(name, "AccCaption") == 0) {
 		return STATUS_OK;
 	} else {
+		_gameRef->_objectPassOnNames._setProperties.setVal(name, true);
 		return BaseScriptHolder::scSetProperty(name, value);
 	}
 }
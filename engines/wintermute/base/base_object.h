@@ -140,6 +140,7 @@ public:
 	virtual ScValue *scGetProperty(const Common::String &name) override;
 	virtual bool scSetProperty(const char *name, ScValue *value) override;
 	virtual bool scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) override;
+	static void initMethodTable(ScNameTable &table);
 	virtual const char *scToString() override;
 };
 
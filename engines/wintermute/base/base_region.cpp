@@ -41,8 +41,11 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(BaseRegion, false)
 
+uint32 BaseRegion::_lastVersion = 0;
+
 //////////////////////////////////////////////////////////////////////////
 BaseRegion::BaseRegion(BaseGame *inGame) : BaseObject(inGame) {
+	changed();
 	_active = true;
 	_editorSelectedPoint = -1;
 	_lastMimicScale = -1;
@@ -67,15 +70,23 @@ void BaseRegion::cleanup() {
 
 	_rect.setEmpty();
 	_editorSelectedPoint = -1;
+	changed();
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseRegion::createRegion() {
+	changed();
 	return DID_SUCCEED(getBoundingRect(&_rect));
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+void BaseRegion::changed() {
+	_version = ++_lastVersion;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool BaseRegion::pointInRegion(int x, int y) {
 	if (_points.size() < 3) {
@@ -437,6 +448,10 @@ bool BaseRegion::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transferSint32(TMEMBER(_lastMimicY));
 	_points.persist(persistMgr);
 
+	if (!persistMgr->getIsSaving()) {
+		changed();
+	}
+
 	return STATUS_OK;
 }
 
@@ -59,7 +59,15 @@ public:
 	virtual bool scSetProperty(const char *name, ScValue *value) override;
 	virtual bool scCallMethod(ScScript *script, ScStack *stack, ScStack *thisStack, const char *name) override;
 	virtual const char *scToString() override;
+
+	// Changes whenever the points of the region or what it blocks change. Unique
+	// among all regions, so a region replaced by another one is noticed too.
+	uint32 getVersion() const { return _version; }
+protected:
+	void changed();
 private:
+	uint32 _version;
+	static uint32 _lastVersion;
 	float _lastMimicScale;
 	int32 _lastMimicX;
 	int32 _lastMimicY;
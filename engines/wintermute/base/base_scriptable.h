@@ -32,6 +32,8 @@
 
 #include "engines/wintermute/base/base_named_object.h"
 #include "engines/wintermute/persistent.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
 
 namespace Wintermute {
 
@@ -39,6 +41,45 @@ class ScValue;
 class ScStack;
 class ScScript;
 
+/**
+ * Property names the native scripting interface of a class passed on to its
+ * parent class. The scGetProperty()/scSetProperty() chains compare a name
+ * against everything the class handles one by one, a name found here can go
+ * to the parent class right away instead. Only valid for classes that decide
+ * what they handle by the name alone.
+ */
+struct ScPassOnNames {
+	Common::HashMap<Common::String, bool> _getProperties;
+	Common::HashMap<Common::String, bool> _setProperties;
+};
+
+/**
+ * IDs of the method names handled by the native scripting interface of a
+ * class, which is the index of the name in the array given to init(). The
+ * scCallMethod() chain compares the ID of a name instead of the name itself,
+ * and a name without an ID goes to the parent class right away.
+ */
+class ScNameTable {
+public:
+	void init(const char *const *names, uint count) {
+		for (uint i = 0; i < count; i++) {
+			_ids[names[i]] = i;
+		}
+	}
+
+	int getId(const char *name) const {
+		IdMap::const_iterator it = _ids.find(name);
+		return it != _ids.end() ? it->_value : -1;
+	}
+
+private:
+	struct NameEqualTo {
+		bool operator()(const char *x, const char *y) const { return strcmp(x, y) == 0; }
+	};
+	typedef Common::HashMap<const char *, int, Common::Hash<const char *>, NameEqualTo> IdMap;
+	IdMap _ids;
+};
+
 class BaseScriptable : public BaseNamedObject {
 public:
 	virtual ScScript *invokeMethodThread(const char *methodName);
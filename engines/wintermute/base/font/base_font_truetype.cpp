@@ -39,7 +39,6 @@
 #include "graphics/fontman.h"
 #include "common/unzip.h"
 #include "common/config-manager.h" // For Scummmodern.zip
-#include <limits.h>
 
 namespace Wintermute {
 
@@ -55,10 +54,6 @@ BaseFontTT::BaseFontTT(BaseGame *inGame) : BaseFont(inGame) {
 	_fallbackFont = nullptr;
 	_deletableFont = nullptr;
 
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		_cachedTexts[i] = nullptr;
-	}
-
 	_lineHeight = 0;
 	_maxCharWidth = _maxCharHeight = 0;
 }
@@ -82,12 +77,7 @@ BaseFontTT::~BaseFontTT(void) {
 
 //////////////////////////////////////////////////////////////////////////
 void BaseFontTT::clearCache() {
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		if (_cachedTexts[i]) {
-			delete _cachedTexts[i];
-		}
-		_cachedTexts[i] = nullptr;
-	}
+	_cachedTexts.clear();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -95,18 +85,7 @@ void BaseFontTT::initLoop() {
 	// we need more aggressive cache management on iOS not to waste too much memory on fonts
 	if (_gameRef->_constrainedMemory) {
 		// purge all cached images not used in the last frame
-		for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-			if (_cachedTexts[i] == nullptr) {
-				continue;
-			}
-
-			if (!_cachedTexts[i]->_marked) {
-				delete _cachedTexts[i];
-				_cachedTexts[i] = nullptr;
-			} else {
-				_cachedTexts[i]->_marked = false;
-			}
-		}
+		_cachedTexts.purgeUnused();
 	}
 }
 
@@ -174,51 +153,27 @@ void BaseFontTT::drawText(const byte *text, int x, int y, int width, TTextAlign
 	BaseRenderer *renderer = _gameRef->_renderer;
 
 	// find cached surface, if exists
-	uint32 minUseTime = UINT_MAX;
-	int minIndex = -1;
+	CachedTextKey key;
+	key._text = textStr;
+	key._width = width;
+	key._align = align;
+	key._maxHeight = maxHeight;
+	key._maxLength = maxLength;
+
 	BaseSurface *surface = nullptr;
 	int textOffset = 0;
 
-	for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-		if (_cachedTexts[i] == nullptr) {
-			minUseTime = 0;
-			minIndex = i;
-		} else {
-			if (_cachedTexts[i]->_text == textStr && _cachedTexts[i]->_align == align && _cachedTexts[i]->_width == width && _cachedTexts[i]->_maxHeight == maxHeight && _cachedTexts[i]->_maxLength == maxLength) {
-				surface = _cachedTexts[i]->_surface;
-				textOffset = _cachedTexts[i]->_textOffset;
-				_cachedTexts[i]->_marked = true;
-				_cachedTexts[i]->_lastUsed = g_system->getMillis();
-				break;
-			} else {
-				if (_cachedTexts[i]->_lastUsed < minUseTime) {
-					minUseTime = _cachedTexts[i]->_lastUsed;
-					minIndex = i;
-				}
-			}
-		}
-	}
-
-	// not found, create one
-	if (!surface) {
+	BaseCachedTTFontText *cachedText = _cachedTexts.get(key);
+	if (cachedText) {
+		surface = cachedText->_surface;
+		textOffset = cachedText->_textOffset;
+	} else {
+		// not found, create one
 		debugC(kWintermuteDebugFont, "Draw text: %s", text);
 		surface = renderTextToTexture(textStr, width, align, maxHeight, textOffset);
 		if (surface) {
 			// write surface to cache
-			if (_cachedTexts[minIndex] != nullptr) {
-				delete _cachedTexts[minIndex];
-			}
-			_cachedTexts[minIndex] = new BaseCachedTTFontText;
-
-			_cachedTexts[minIndex]->_surface = surface;
-			_cachedTexts[minIndex]->_align = align;
-			_cachedTexts[minIndex]->_width = width;
-			_cachedTexts[minIndex]->_maxHeight = maxHeight;
-			_cachedTexts[minIndex]->_maxLength = maxLength;
-			_cachedTexts[minIndex]->_text = textStr;
-			_cachedTexts[minIndex]->_textOffset = textOffset;
-			_cachedTexts[minIndex]->_marked = true;
-			_cachedTexts[minIndex]->_lastUsed = g_system->getMillis();
+			_cachedTexts.put(key, new BaseCachedTTFontText(surface, textOffset), surface->getWidth() * surface->getHeight() * 4);
 		}
 	}
 
@@ -541,9 +496,6 @@ bool BaseFontTT::persist(BasePersistenceManager *persistMgr) {
 	}
 
 	if (!persistMgr->getIsSaving()) {
-		for (int i = 0; i < NUM_CACHED_TEXTS; i++) {
-			_cachedTexts[i] = nullptr;
-		}
 		_fallbackFont = _font = _deletableFont = nullptr;
 	}
 
@@ -561,6 +513,9 @@ bool BaseFontTT::initFont() {
 	if (!_fontFile) {
 		return STATUS_FAILED;
 	}
+
+	_cachedTexts.setMaxSize(_gameRef->_constrainedMemory ? TEXT_CACHE_SIZE_CONSTRAINED : TEXT_CACHE_SIZE);
+
 #ifdef USE_FREETYPE2
 	Common::String fallbackFilename;
 	// Handle Bold atleast for the fallback-case.
@@ -35,8 +35,11 @@
 #include "common/rect.h"
 #include "graphics/surface.h"
 #include "graphics/font.h"
+#include "graphics/fonts/textcache.h"
 
-#define NUM_CACHED_TEXTS 30
+// Limits for the size of the rendered texts each font keeps, in bytes
+#define TEXT_CACHE_SIZE (4 * 1024 * 1024)
+#define TEXT_CACHE_SIZE_CONSTRAINED (1024 * 1024)
 
 namespace Wintermute {
 
@@ -45,25 +48,12 @@ private:
 	//////////////////////////////////////////////////////////////////////////
 	class BaseCachedTTFontText {
 	public:
-		WideString _text;
-		int32 _width;
-		TTextAlign _align;
-		int32 _maxHeight;
-		int32 _maxLength;
 		BaseSurface *_surface;
-		int32 _priority;
 		int32 _textOffset;
-		bool _marked;
-		uint32 _lastUsed;
-
-		BaseCachedTTFontText() : _text() {
-			//_text = L"";
-			_width = _maxHeight = _maxLength = -1;
-			_align = TAL_LEFT;
-			_surface = nullptr;
-			_textOffset = 0;
-			_lastUsed = 0;
-			_marked = false;
+
+		BaseCachedTTFontText(BaseSurface *surface, int32 textOffset) {
+			_surface = surface;
+			_textOffset = textOffset;
 		}
 
 		virtual ~BaseCachedTTFontText() {
@@ -73,6 +63,28 @@ private:
 		}
 	};
 
+	struct CachedTextKey {
+		WideString _text;
+		int32 _width;
+		TTextAlign _align;
+		int32 _maxHeight;
+		int32 _maxLength;
+
+		bool operator==(const CachedTextKey &key) const {
+			return _width == key._width && _align == key._align && _maxHeight == key._maxHeight && _maxLength == key._maxLength && _text == key._text;
+		}
+	};
+
+	struct CachedTextKeyHash {
+		uint operator()(const CachedTextKey &key) const {
+			uint hash = key._width ^ (key._align << 16);
+			for (uint i = 0; i < key._text.size(); i++) {
+				hash = (1000003 * hash) ^ key._text[i];
+			}
+			return hash ^ key._text.size();
+		}
+	};
+
 public:
 	//////////////////////////////////////////////////////////////////////////
 	class BaseTTFontLayer {
@@ -121,7 +133,7 @@ private:
 
 	BaseSurface *renderTextToTexture(const WideString &text, int width, TTextAlign align, int maxHeight, int &textOffset);
 
-	BaseCachedTTFontText *_cachedTexts[NUM_CACHED_TEXTS];
+	Graphics::TextCache<CachedTextKey, BaseCachedTTFontText, CachedTextKeyHash> _cachedTexts;
 
 	bool initFont();
 
@@ -34,12 +34,14 @@
 #include "engines/wintermute/math/math_util.h"
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_sprite.h"
+#include "engines/wintermute/base/font/base_font.h"
 #include "common/system.h"
 #include "graphics/transparent_surface.h"
 #include "common/queue.h"
 #include "common/config-manager.h"
 
-#define DIRTY_RECT_LIMIT 800
+// Beyond this many disjoint dirty rects, they are collapsed into their bounding box
+#define DIRTY_RECT_LIMIT 32
 
 namespace Wintermute {
 
@@ -57,25 +59,20 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 
 	_borderLeft = _borderRight = _borderTop = _borderBottom = 0;
 	_ratioX = _ratioY = 1.0f;
-	_dirtyRect = nullptr;
 	_disableDirtyRects = false;
 	if (ConfMan.hasKey("dirty_rects")) {
 		_disableDirtyRects = !ConfMan.getBool("dirty_rects");
 	}
 
 	_lastScreenChangeID = g_system->getScreenChangeID();
+
+	memset(&_frameStats, 0, sizeof(_frameStats));
+	memset(&_lastFrameStats, 0, sizeof(_lastFrameStats));
 }
 
 //////////////////////////////////////////////////////////////////////////
 BaseRenderOSystem::~BaseRenderOSystem() {
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
-	}
-
-	delete _dirtyRect;
+	deleteAllTickets();
 
 	_renderSurface->free();
 	delete _renderSurface;
@@ -152,10 +149,12 @@ bool BaseRenderOSystem::indicatorFlip() {
 }
 
 bool BaseRenderOSystem::flip() {
+	_lastFrameStats = _frameStats;
+	memset(&_frameStats, 0, sizeof(_frameStats));
+
 	if (_skipThisFrame) {
 		_skipThisFrame = false;
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		g_system->updateScreen();
 		_needsFlip = false;
 
@@ -176,9 +175,7 @@ bool BaseRenderOSystem::flip() {
 		RenderQueueIterator it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			if ((*it)->_wantsDraw == false) {
-				RenderTicket *ticket = *it;
-				it = _renderQueue.erase(it);
-				delete ticket;
+				it = deleteTicket(it);
 			} else {
 				(*it)->_wantsDraw = false;
 				++it;
@@ -194,9 +191,7 @@ bool BaseRenderOSystem::flip() {
 		if (_disableDirtyRects || screenChanged) {
 			g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
 		}
-		//  g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-		delete _dirtyRect;
-		_dirtyRect = nullptr;
+		_dirtyRects.clear();
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
@@ -269,11 +264,12 @@ Graphics::PixelFormat BaseRenderOSystem::getPixelFormat() const {
 }
 
 void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
+	_frameStats.tickets++;
 
 	if (_disableDirtyRects) {
-		RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
+		RenderTicket *ticket = createTicket(owner, surf, srcRect, dstRect, transform);
 		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
+		queueTicket(_renderQueue.end(), ticket);
 		drawFromSurface(ticket);
 		return;
 	}
@@ -285,34 +281,109 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
-				}
-				return;
+		// Every ticket behind _lastFrameIter is one from last frame that hasn't been
+		// drawn yet, so that is what the index has to come up with.
+		RenderTicket *compareTicket = findUndrawnTicket(compare);
+		if (compareTicket) {
+			_frameStats.reusedTickets++;
+			if (_disableDirtyRects) {
+				drawFromSurface(compareTicket);
+			} else {
+				drawFromQueuedTicket(compareTicket->_queuePos);
 			}
+			return;
 		}
 	}
-	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
+	RenderTicket *ticket = createTicket(owner, surf, srcRect, dstRect, transform);
 	if (!_disableDirtyRects) {
 		drawFromTicket(ticket);
 	} else {
 		ticket->_wantsDraw = true;
-		_renderQueue.push_back(ticket);
+		queueTicket(_renderQueue.end(), ticket);
 		drawFromSurface(ticket);
 	}
 }
 
+RenderTicket *BaseRenderOSystem::createTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform) {
+	return new (_ticketPool) RenderTicket(owner, surf, srcRect, dstRect, transform);
+}
+
+void BaseRenderOSystem::queueTicket(const RenderQueueIterator &pos, RenderTicket *renderTicket) {
+	_renderQueue.insert(pos, renderTicket);
+	renderTicket->_queuePos = pos;
+	--renderTicket->_queuePos;
+	indexTicket(renderTicket);
+}
+
+BaseRenderOSystem::RenderQueueIterator BaseRenderOSystem::deleteTicket(const RenderQueueIterator &ticket) {
+	RenderTicket *renderTicket = *ticket;
+	unindexTicket(renderTicket);
+	RenderQueueIterator next = _renderQueue.erase(ticket);
+	_ticketPool.deleteChunk(renderTicket);
+	return next;
+}
+
+void BaseRenderOSystem::deleteAllTickets() {
+	RenderQueueIterator it = _renderQueue.begin();
+	while (it != _renderQueue.end()) {
+		RenderTicket *ticket = *it;
+		it = _renderQueue.erase(it);
+		_ticketPool.deleteChunk(ticket);
+	}
+	_ticketIndex.clear();
+}
+
+void BaseRenderOSystem::indexTicket(RenderTicket *renderTicket) {
+	// Append, so that of several equal tickets the oldest one is found first
+	renderTicket->_nextInBucket = nullptr;
+	RenderTicket *&head = _ticketIndex[renderTicket->getHash()];
+	if (!head) {
+		head = renderTicket;
+		return;
+	}
+	RenderTicket *last = head;
+	while (last->_nextInBucket) {
+		last = last->_nextInBucket;
+	}
+	last->_nextInBucket = renderTicket;
+}
+
+void BaseRenderOSystem::unindexTicket(RenderTicket *renderTicket) {
+	Common::HashMap<uint32, RenderTicket *>::iterator bucket = _ticketIndex.find(renderTicket->getHash());
+	if (bucket == _ticketIndex.end()) {
+		return;
+	}
+	if (bucket->_value == renderTicket) {
+		if (renderTicket->_nextInBucket) {
+			bucket->_value = renderTicket->_nextInBucket;
+		} else {
+			_ticketIndex.erase(bucket);
+		}
+	} else {
+		RenderTicket *prev = bucket->_value;
+		while (prev->_nextInBucket && prev->_nextInBucket != renderTicket) {
+			prev = prev->_nextInBucket;
+		}
+		if (prev->_nextInBucket) {
+			prev->_nextInBucket = renderTicket->_nextInBucket;
+		}
+	}
+	renderTicket->_nextInBucket = nullptr;
+}
+
+RenderTicket *BaseRenderOSystem::findUndrawnTicket(const RenderTicket &compare) const {
+	Common::HashMap<uint32, RenderTicket *>::const_iterator bucket = _ticketIndex.find(compare.getHash());
+	if (bucket == _ticketIndex.end()) {
+		return nullptr;
+	}
+	for (RenderTicket *ticket = bucket->_value; ticket; ticket = ticket->_nextInBucket) {
+		if (!ticket->_wantsDraw && ticket->_isValid && *ticket == compare) {
+			return ticket;
+		}
+	}
+	return nullptr;
+}
+
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 	addDirtyRect(renderTicket->_dstRect);
 	renderTicket->_isValid = false;
@@ -335,13 +406,13 @@ void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	// In-order
 	if (_renderQueue.empty() || _lastFrameIter == _renderQueue.end()) {
 		_lastFrameIter--;
-		_renderQueue.push_back(renderTicket);
+		queueTicket(_renderQueue.end(), renderTicket);
 		++_lastFrameIter;
 		addDirtyRect(renderTicket->_dstRect);
 	} else {
 		// Before something
 		RenderQueueIterator pos = _lastFrameIter;
-		_renderQueue.insert(pos, renderTicket);
+		queueTicket(pos, renderTicket);
 		--_lastFrameIter;
 		addDirtyRect(renderTicket->_dstRect);
 	}
@@ -358,6 +429,7 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 		--_lastFrameIter;
 		// Remove the ticket from the list
 		assert(*_lastFrameIter != renderTicket);
+		unindexTicket(renderTicket);
 		_renderQueue.erase(ticket);
 		// Is not in order, so readd it as if it was a new ticket
 		drawFromTicket(renderTicket);
@@ -365,12 +437,35 @@ void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket)
 }
 
 void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
-	if (!_dirtyRect) {
-		_dirtyRect = new Common::Rect(rect);
-	} else {
-		_dirtyRect->extend(rect);
+	Common::Rect dirty(rect);
+	dirty.clip(_renderRect);
+	if (dirty.isEmpty()) {
+		return;
+	}
+	// Swallow every rect the new one overlaps, growing it as we go, until
+	// it is disjoint from the rest.
+	bool merged;
+	do {
+		merged = false;
+		for (uint i = 0; i < _dirtyRects.size(); i++) {
+			if (_dirtyRects[i].intersects(dirty)) {
+				dirty.extend(_dirtyRects[i]);
+				_dirtyRects.remove_at(i);
+				merged = true;
+				break;
+			}
+		}
+	} while (merged);
+	_dirtyRects.push_back(dirty);
+
+	if (_dirtyRects.size() > DIRTY_RECT_LIMIT) {
+		Common::Rect bounds = _dirtyRects[0];
+		for (uint i = 1; i < _dirtyRects.size(); i++) {
+			bounds.extend(_dirtyRects[i]);
+		}
+		_dirtyRects.clear();
+		_dirtyRects.push_back(bounds);
 	}
-	_dirtyRect->clip(_renderRect);
 }
 
 void BaseRenderOSystem::drawTickets() {
@@ -381,15 +476,13 @@ void BaseRenderOSystem::drawTickets() {
 	// we have a copy of their data, so their invalidness won't affect us.
 	while (it != _renderQueue.end()) {
 		if ((*it)->_wantsDraw == false) {
-			RenderTicket *ticket = *it;
 			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
+			it = deleteTicket(it);
 		} else {
 			++it;
 		}
 	}
-	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
+	if (_dirtyRects.empty()) {
 		it = _renderQueue.begin();
 		while (it != _renderQueue.end()) {
 			RenderTicket *ticket = *it;
@@ -399,29 +492,53 @@ void BaseRenderOSystem::drawTickets() {
 		return;
 	}
 
-	it = _renderQueue.begin();
 	_lastFrameIter = _renderQueue.end();
+	for (uint i = 0; i < _dirtyRects.size(); i++) {
+		drawDirtyRect(_dirtyRects[i]);
+	}
+	_frameStats.dirtyRects += _dirtyRects.size();
+
+	// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
+	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
+		(*it)->_wantsDraw = false;
+	}
+
+	it = _renderQueue.begin();
+	// Clean out the old tickets
+	while (it != _renderQueue.end()) {
+		if ((*it)->_isValid == false) {
+			addDirtyRect((*it)->_dstRect);
+			it = deleteTicket(it);
+		} else {
+			++it;
+		}
+	}
+
+}
+
+void BaseRenderOSystem::drawDirtyRect(const Common::Rect &dirtyRect) {
+	RenderQueueIterator it = _renderQueue.begin();
 	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
 	// the background color. Typical use-case: Fullscreen FMVs.
 	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
+	if (it != _renderQueue.end() && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
 		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
+		if (dirtyRect != (*it)->_dstRect) {
 			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
+			_renderSurface->fillRect(dirtyRect, _clearColor);
 		}
 		// Otherwise Do NOT fill.
 	} else {
 		// Apply the clear-color to the dirty rect.
-		_renderSurface->fillRect(*_dirtyRect, _clearColor);
+		_renderSurface->fillRect(dirtyRect, _clearColor);
 	}
 	for (; it != _renderQueue.end(); ++it) {
 		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
+		if (ticket->_dstRect.intersects(dirtyRect)) {
 			// dstClip is the area we want redrawn.
 			Common::Rect dstClip(ticket->_dstRect);
 			// reduce it to the dirty rect
-			dstClip.clip(*_dirtyRect);
+			dstClip.clip(dirtyRect);
 			// we need to keep track of the position to redraw the dirty rect
 			Common::Rect pos(dstClip);
 			int16 offsetX = ticket->_dstRect.left;
@@ -432,32 +549,18 @@ void BaseRenderOSystem::drawTickets() {
 			drawFromSurface(ticket, &pos, &dstClip);
 			_needsFlip = true;
 		}
-		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
-		ticket->_wantsDraw = false;
-	}
-	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
-
-	it = _renderQueue.begin();
-	// Clean out the old tickets
-	while (it != _renderQueue.end()) {
-		if ((*it)->_isValid == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
-			delete ticket;
-		} else {
-			++it;
-		}
 	}
-
+	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(dirtyRect.left, dirtyRect.top), _renderSurface->pitch, dirtyRect.left, dirtyRect.top, dirtyRect.width(), dirtyRect.height());
 }
 
 // Replacement for SDL2's SDL_RenderCopy
 void BaseRenderOSystem::drawFromSurface(RenderTicket *ticket) {
+	_frameStats.pixelsBlitted += ticket->_dstRect.width() * ticket->_dstRect.height();
 	ticket->drawToSurface(_renderSurface);
 }
 
 void BaseRenderOSystem::drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect) {
+	_frameStats.pixelsBlitted += dstRect->width() * dstRect->height();
 	ticket->drawToSurface(_renderSurface, dstRect, clipRect);
 }
 
@@ -557,6 +660,17 @@ void BaseRenderOSystem::dumpData(const char *filename) {
 	warning("BaseRenderOSystem::DumpData(%s) - stubbed", filename); // TODO
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool BaseRenderOSystem::displayDebugInfo() {
+	char str[100];
+	sprintf(str, "Tickets: %d (reused: %d, queued: %d)", _lastFrameStats.tickets, _lastFrameStats.reusedTickets, _renderQueue.size());
+	_gameRef->getSystemFont()->drawText((byte *)str, 0, 30, getWidth(), TAL_RIGHT);
+
+	sprintf(str, "Dirty rects: %d, pixels blitted: %d", _lastFrameStats.dirtyRects, _lastFrameStats.pixelsBlitted);
+	_gameRef->getSystemFont()->drawText((byte *)str, 0, 50, getWidth(), TAL_RIGHT);
+	return STATUS_OK;
+}
+
 BaseSurface *BaseRenderOSystem::createSurface() {
 	return new BaseSurfaceOSystem(_gameRef);
 }
@@ -565,12 +679,7 @@ void BaseRenderOSystem::endSaveLoad() {
 	BaseRenderer::endSaveLoad();
 
 	// Clear the scale-buffered tickets as we just loaded.
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
-	}
+	deleteAllTickets();
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
@@ -30,14 +30,17 @@
 #define WINTERMUTE_BASE_RENDERER_SDL_H
 
 #include "engines/wintermute/base/gfx/base_renderer.h"
+#include "engines/wintermute/base/gfx/osystem/render_ticket.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
+#include "common/array.h"
 #include "common/list.h"
+#include "common/hashmap.h"
+#include "common/memorypool.h"
 #include "graphics/transform_struct.h"
 
 namespace Wintermute {
 class BaseSurfaceOSystem;
-class RenderTicket;
 /**
  * A 2D-renderer implementation for WME.
  * This renderer makes use of a "ticket"-system, where all draw-calls
@@ -53,6 +56,11 @@ class RenderTicket;
  * being equal, this information is then used to check whether the draw order changed,
  * which will then create a need for redrawing, as we draw with an alpha-channel here.
  *
+ * Tickets are looked up by a hash of their draw arguments, so matching a draw-call
+ * against last frame's tickets does not depend on the length of the queue. The
+ * screen areas that changed are collected as a small set of disjoint dirty rects,
+ * each of which is cleared, recomposited and copied to the screen separately.
+ *
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accomodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
@@ -100,6 +108,7 @@ public:
 	void pointToScreen(Point32 *point);
 
 	void dumpData(const char *filename) override;
+	bool displayDebugInfo() override;
 
 	float getScaleRatioX() const override {
 		return _ratioX;
@@ -115,6 +124,8 @@ public:
 private:
 	/**
 	 * Mark a specified rect of the screen as dirty.
+	 * Overlapping dirty rects are merged, so the dirty region always
+	 * consists of disjoint rects.
 	 * @param rect the region to be marked as dirty
 	 */
 	void addDirtyRect(const Common::Rect &rect);
@@ -122,12 +133,51 @@ private:
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Redraw a single dirty rect from the tickets in the queue.
+	 * @param dirtyRect the region of the screen to recomposite
+	 */
+	void drawDirtyRect(const Common::Rect &dirtyRect);
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
-	Common::Rect *_dirtyRect;
+
+	RenderTicket *createTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
+	/**
+	 * Insert a ticket into the render queue and the ticket index.
+	 * @param pos the ticket is inserted before this position
+	 * @param renderTicket the ticket to be inserted
+	 */
+	void queueTicket(const RenderQueueIterator &pos, RenderTicket *renderTicket);
+	/**
+	 * Remove a ticket from the render queue and the ticket index, and free it.
+	 * @return iterator to the ticket following the removed one
+	 */
+	RenderQueueIterator deleteTicket(const RenderQueueIterator &ticket);
+	void deleteAllTickets();
+	void indexTicket(RenderTicket *renderTicket);
+	void unindexTicket(RenderTicket *renderTicket);
+	/**
+	 * Find a ticket from last frame that has not been drawn yet this frame
+	 * and is equal to the given one.
+	 */
+	RenderTicket *findUndrawnTicket(const RenderTicket &compare) const;
+
+	Common::Array<Common::Rect> _dirtyRects;
 	Common::List<RenderTicket *> _renderQueue;
+	Common::ObjectPool<RenderTicket, 64> _ticketPool;
+	/** Ticket hash -> first ticket in a chain linked through RenderTicket::_nextInBucket */
+	Common::HashMap<uint32, RenderTicket *> _ticketIndex;
+
+	struct FrameStats {
+		uint32 tickets;       ///< Draw-calls made in the frame
+		uint32 reusedTickets; ///< Draw-calls matched with a ticket from the previous frame
+		uint32 dirtyRects;    ///< Number of dirty rects recomposited
+		uint32 pixelsBlitted; ///< Pixels drawn into the back buffer
+	};
+	FrameStats _frameStats;
+	FrameStats _lastFrameStats;
 
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
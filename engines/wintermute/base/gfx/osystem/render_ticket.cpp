@@ -40,7 +40,9 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	_dstRect(*dstRect),
 	_isValid(true),
 	_wantsDraw(true),
-	_transform(transform) {
+	_transform(transform),
+	_nextInBucket(nullptr) {
+	_hash = computeHash();
 	if (surf) {
 		_surface = new Graphics::Surface();
 		_surface->create((uint16)srcRect->width(), (uint16)srcRect->height(), surf->format);
@@ -95,6 +97,31 @@ bool RenderTicket::operator==(const RenderTicket &t) const {
 	return true;
 }
 
+static inline uint32 hashCombine(uint32 hash, uint32 value) {
+	return (hash ^ value) * 16777619;
+}
+
+static inline uint32 hashCombine(uint32 hash, const Common::Rect &rect) {
+	hash = hashCombine(hash, ((uint16)rect.left << 16) | (uint16)rect.top);
+	return hashCombine(hash, ((uint16)rect.right << 16) | (uint16)rect.bottom);
+}
+
+uint32 RenderTicket::computeHash() const {
+	// Only the fields that operator== looks at may go in here
+	uint64 owner = (uint64)(size_t)_owner;
+	uint32 hash = 2166136261u;
+	hash = hashCombine(hash, (uint32)(owner ^ (owner >> 32)));
+	hash = hashCombine(hash, _srcRect);
+	hash = hashCombine(hash, _dstRect);
+	hash = hashCombine(hash, (uint32)_transform._angle);
+	hash = hashCombine(hash, ((uint16)_transform._zoom.x << 16) | (uint16)_transform._zoom.y);
+	hash = hashCombine(hash, ((uint16)_transform._offset.x << 16) | (uint16)_transform._offset.y);
+	hash = hashCombine(hash, _transform._rgbaMod);
+	hash = hashCombine(hash, (_transform._flip << 16) | (_transform._alphaDisable << 8) | (byte)_transform._blendMode);
+	hash = hashCombine(hash, ((uint16)_transform._numTimesX << 16) | (uint16)_transform._numTimesY);
+	return hash;
+}
+
 // Replacement for SDL2's SDL_RenderCopy
 void RenderTicket::drawToSurface(Graphics::Surface *_targetSurface) const {
 	Graphics::TransparentSurface src(*getSurface(), false);
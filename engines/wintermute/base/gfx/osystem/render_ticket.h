@@ -31,6 +31,7 @@
 
 #include "graphics/transparent_surface.h"
 #include "graphics/surface.h"
+#include "common/list.h"
 #include "common/rect.h"
 
 namespace Wintermute {
@@ -52,7 +53,7 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()), _owner(nullptr), _nextInBucket(nullptr), _hash(0), _surface(nullptr) {}
 	~RenderTicket();
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
@@ -70,7 +71,20 @@ public:
 	BaseSurfaceOSystem *_owner;
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
+
+	/**
+	 * Hash over everything operator== compares, so that the renderer can
+	 * look up last frame's ticket for a draw call without scanning the queue.
+	 */
+	uint32 getHash() const { return _hash; }
+
+	// Bookkeeping for BaseRenderOSystem's ticket index:
+	RenderTicket *_nextInBucket;
+	Common::List<RenderTicket *>::iterator _queuePos;
 private:
+	uint32 computeHash() const;
+
+	uint32 _hash;
 	Graphics::Surface *_surface;
 	Common::Rect _srcRect;
 };
@@ -395,6 +395,7 @@ void ScScript::cleanup() {
 	}
 	_symbols = nullptr;
 	_numSymbols = 0;
+	_variableCache.clear();
 
 	if (_globals && !_thread) {
 		delete _globals;
@@ -692,7 +693,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getSymbolVar(getDWORD());
 		if (false && /*var->_type==VAL_OBJECT ||*/ var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
 			_stack->push(_operand);
@@ -703,15 +704,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getSymbolVar(getDWORD());
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getSymbolVar(getDWORD());
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -764,7 +764,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getSymbolVar(getDWORD()));
 		_thisStack->push(_operand);
 		break;
 
@@ -1164,6 +1164,41 @@ ScValue *ScScript::getVar(char *name) {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScScript::getSymbolVar(uint32 symbolIndex) {
+	if (_variableCache.size() != _numSymbols) {
+		_variableCache.clear();
+		_variableCache.resize(_numSymbols);
+	}
+
+	ScValue *scope = _scopeStack->_sP >= 0 ? _scopeStack->getTop() : nullptr;
+	VariableCacheEntry &entry = _variableCache[symbolIndex];
+
+	if (entry._var && entry._scope == scope &&
+	        (!scope || entry._scopeVersion == scope->getPropsVersion()) &&
+	        entry._globalsVersion == _globals->getPropsVersion() &&
+	        entry._engineGlobalsVersion == _engine->_globals->getPropsVersion()) {
+		return entry._var;
+	}
+
+	ScValue *ret = getVar(_symbols[symbolIndex]);
+
+	// natives resolve their properties on every access and references point elsewhere, so only cache plain scopes
+	entry._var = nullptr;
+	if (ret && (!scope || (scope->_type != VAL_NATIVE && scope->_type != VAL_VARIABLE_REF)) &&
+	        _globals->_type != VAL_NATIVE && _globals->_type != VAL_VARIABLE_REF &&
+	        _engine->_globals->_type != VAL_NATIVE && _engine->_globals->_type != VAL_VARIABLE_REF) {
+		entry._var = ret;
+		entry._scope = scope;
+		entry._scopeVersion = scope ? scope->getPropsVersion() : 0;
+		entry._globalsVersion = _globals->getPropsVersion();
+		entry._engineGlobalsVersion = _engine->_globals->getPropsVersion();
+	}
+
+	return ret;
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 bool ScScript::waitFor(BaseObject *object) {
 	if (_unbreakable) {
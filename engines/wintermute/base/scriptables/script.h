@@ -77,6 +77,7 @@ public:
 	TScriptState _state;
 	TScriptState _origState;
 	ScValue *getVar(char *name);
+	ScValue *getSymbolVar(uint32 symbolIndex);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -150,6 +151,17 @@ public:
 private:
 	char **_symbols;
 	uint32 _numSymbols;
+
+	// Variable each symbol resolved to last time, along with the state of the
+	// scopes it was looked up in. Reused as long as none of them changed.
+	struct VariableCacheEntry {
+		ScValue *_var;
+		ScValue *_scope;
+		uint32 _scopeVersion;
+		uint32 _globalsVersion;
+		uint32 _engineGlobalsVersion;
+	};
+	Common::Array<VariableCacheEntry> _variableCache;
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
 	TEventPos *_events;
@@ -42,6 +42,8 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScValue, false)
 
+uint32 ScValue::_lastPropsVersion = 0;
+
 //////////////////////////////////////////////////////////////////////////
 ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_type = VAL_NULL;
@@ -54,6 +56,7 @@ ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	changePropsVersion();
 }
 
 
@@ -69,6 +72,7 @@ ScValue::ScValue(BaseGame *inGame, bool val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	changePropsVersion();
 }
 
 
@@ -84,6 +88,7 @@ ScValue::ScValue(BaseGame *inGame, int32 val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	changePropsVersion();
 }
 
 
@@ -99,6 +104,7 @@ ScValue::ScValue(BaseGame *inGame, double val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	changePropsVersion();
 }
 
 
@@ -115,6 +121,7 @@ ScValue::ScValue(BaseGame *inGame, const char *val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	changePropsVersion();
 }
 
 
@@ -201,6 +208,7 @@ bool ScValue::deleteProp(const char *name) {
 	if (_valIter != _valObject.end()) {
 		delete _valIter->_value;
 		_valIter->_value = nullptr;
+		changePropsVersion();
 	}
 
 	return STATUS_OK;
@@ -228,6 +236,7 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 		}
 		if (!newVal) {
 			newVal = new ScValue(_gameRef);
+			changePropsVersion();
 		} else {
 			newVal->cleanup();
 		}
@@ -278,6 +287,7 @@ void ScValue::deleteProps() {
 		_valIter++;
 	}
 	_valObject.clear();
+	changePropsVersion();
 }
 
 
@@ -508,6 +518,7 @@ void ScValue::setNative(BaseScriptable *val, bool persistent) {
 
 		_type = VAL_NATIVE;
 		_persistent = persistent;
+		changePropsVersion();
 
 		_valNative = val;
 		if (_valNative && !_persistent) {
@@ -533,6 +544,7 @@ void ScValue::setObject() {
 void ScValue::setReference(ScValue *val) {
 	_valRef = val;
 	_type = VAL_VARIABLE_REF;
+	changePropsVersion();
 }
 
 
@@ -750,6 +762,7 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	} else {
 		_valObject.clear();
 	}
+	changePropsVersion();
 }
 
 
@@ -822,6 +835,7 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 			_valObject[str] = val;
 			delete[] str;
 		}
+		changePropsVersion();
 	}
 
 	persistMgr->transferPtr(TMEMBER_PTR(_valRef));
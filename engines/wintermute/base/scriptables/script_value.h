@@ -101,11 +101,25 @@ public:
 	Common::HashMap<Common::String, ScValue *> _valObject;
 	Common::HashMap<Common::String, ScValue *>::iterator _valIter;
 
+	// Changes whenever a property is added or removed, or the value turns into
+	// something that resolves properties differently (a native or a reference).
+	// Lets ScScript cache variable lookups.
+	uint32 getPropsVersion() const {
+		return _propsVersion;
+	}
+
 	bool setProperty(const char *propName, int32 value);
 	bool setProperty(const char *propName, const char *value);
 	bool setProperty(const char *propName, double value);
 	bool setProperty(const char *propName, bool value);
 	bool setProperty(const char *propName);
+
+private:
+	uint32 _propsVersion;
+	static uint32 _lastPropsVersion;
+	void changePropsVersion() {
+		_propsVersion = ++_lastPropsVersion;
+	}
 };
 
 } // End of namespace Wintermute
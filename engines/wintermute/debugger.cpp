@@ -22,6 +22,8 @@
 
 #include "engines/wintermute/debugger.h"
 #include "engines/wintermute/wintermute.h"
+#include "engines/wintermute/ad/ad_game.h"
+#include "engines/wintermute/ad/ad_scene.h"
 #include "engines/wintermute/base/base_engine.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/base/base_game.h"
@@ -31,6 +33,7 @@ namespace Wintermute {
 Console::Console(WintermuteEngine *vm) : GUI::Debugger(), _engineRef(vm) {
 	registerCmd("show_fps", WRAP_METHOD(Console, Cmd_ShowFps));
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
+	registerCmd("pathfinder_stats", WRAP_METHOD(Console, Cmd_PathFinderStats));
 }
 
 Console::~Console(void) {
@@ -81,4 +84,30 @@ bool Console::Cmd_DumpFile(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_PathFinderStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && Common::String(argv[1]) != "reset")) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	AdScene *scene = ((AdGame *)_engineRef->_game)->_scene;
+	if (!scene) {
+		debugPrintf("No scene loaded\n");
+		return true;
+	}
+
+	AdScene::PathFinderStats &stats = scene->_pfStats;
+	if (argc == 2) {
+		stats.reset();
+		debugPrintf("Path finder statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("Searches: %d\n", stats._searches);
+	debugPrintf("Points expanded: %d\n", stats._steps);
+	debugPrintf("Lines traced: %d, cached: %d\n", stats._segmentChecks, stats._cacheHits);
+	debugPrintf("Time: %d ms total, %d ms max per frame\n", stats._totalTime, stats._maxFrameTime);
+	return true;
+}
+
 } // End of namespace Wintermute
@@ -77,6 +77,16 @@ void RenderManager::renderSceneToScreen() {
 	Graphics::Surface *in = &_backgroundSurface;
 	Common::Rect outWndDirtyRect;
 
+	// Redraw the area of deleted effects without them. prepareBackground()
+	// only marks the changed background, so this has to be added here.
+	if (!_deletedEffectsDirtyRect.isEmpty()) {
+		if (_backgroundSurfaceDirtyRect.isEmpty())
+			_backgroundSurfaceDirtyRect = _deletedEffectsDirtyRect;
+		else
+			_backgroundSurfaceDirtyRect.extend(_deletedEffectsDirtyRect);
+		_deletedEffectsDirtyRect = Common::Rect();
+	}
+
 	// If we have graphical effects, we apply them using a temporary buffer
 	if (!_effects.empty()) {
 		bool copied = false;
@@ -115,11 +125,7 @@ void RenderManager::renderSceneToScreen() {
 
 	RenderTable::RenderState state = _renderTable.getRenderState();
 	if (state == RenderTable::PANORAMA || state == RenderTable::TILT) {
-		if (!_backgroundSurfaceDirtyRect.isEmpty()) {
-			_renderTable.mutateImage(&_warpedSceneSurface, in);
-			out = &_warpedSceneSurface;
-			outWndDirtyRect = Common::Rect(_workingWindow.width(), _workingWindow.height());
-		}
+		outWndDirtyRect = _renderTable.mutateImage(&_warpedSceneSurface, in, _backgroundSurfaceDirtyRect);
 	} else {
 		out = in;
 		outWndDirtyRect = _backgroundSurfaceDirtyRect;
@@ -782,10 +788,25 @@ void RenderManager::addEffect(GraphicsEffect *_effect) {
 }
 
 void RenderManager::deleteEffect(uint32 ID) {
-	for (EffectsList::iterator it = _effects.begin(); it != _effects.end(); it++) {
+	EffectsList::iterator it = _effects.begin();
+	while (it != _effects.end()) {
 		if ((*it)->getKey() == ID) {
+			Common::Rect screenSpaceLocation = (*it)->getRegion();
+			if ((*it)->isPort())
+				screenSpaceLocation = transformBackgroundSpaceRectToScreenSpace(screenSpaceLocation);
+			screenSpaceLocation.clip(_workingWindow.width(), _workingWindow.height());
+
+			if (!screenSpaceLocation.isEmpty()) {
+				if (_deletedEffectsDirtyRect.isEmpty())
+					_deletedEffectsDirtyRect = screenSpaceLocation;
+				else
+					_deletedEffectsDirtyRect.extend(screenSpaceLocation);
+			}
+
 			delete *it;
 			it = _effects.erase(it);
+		} else {
+			it++;
 		}
 	}
 }
@@ -99,6 +99,9 @@ private:
 	// If it's a panorma / tilt scene, the pixels will be first warped to _warpedSceneSurface
 	Graphics::Surface _backgroundSurface;
 	Common::Rect _backgroundSurfaceDirtyRect;
+	// The screen space area of deleted effects, which still shows their last
+	// drawing until it is rendered again
+	Common::Rect _deletedEffectsDirtyRect;
 
 	// A buffer for subtitles
 	Graphics::Surface _subtitleSurface;
@@ -30,21 +30,32 @@ namespace ZVision {
 RenderTable::RenderTable(uint numColumns, uint numRows)
 	: _numRows(numRows),
 	  _numColumns(numColumns),
-	  _renderState(FLAT) {
+	  _renderState(FLAT),
+	  _tableChanged(true) {
 	assert(numRows != 0 && numColumns != 0);
 
-	_internalBuffer = new Common::Point[numRows * numColumns];
+	_offsetTable = new int32[numRows * numColumns];
+	_columnSpans.resize(numColumns);
+	_rowSpans.resize(numRows);
+
+	// Start out with an identity mapping
+	resetSourceSpans();
+	for (uint y = 0; y < numRows; ++y) {
+		for (uint x = 0; x < numColumns; ++x)
+			setSource(x, y, x, y);
+	}
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
 }
 
 RenderTable::~RenderTable() {
-	delete[] _internalBuffer;
+	delete[] _offsetTable;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
 	_renderState = newState;
+	_tableChanged = true;
 
 	switch (newState) {
 	case PANORAMA:
@@ -72,59 +83,103 @@ const Common::Point RenderTable::convertWarpedCoordToFlatCoord(const Common::Poi
 		return Common::Point(x, y);
 	}
 
-	uint32 index = point.y * _numColumns + point.x;
-
-	Common::Point newPoint(point);
-	newPoint.x += _internalBuffer[index].x;
-	newPoint.y += _internalBuffer[index].y;
+	int32 sourceOffset = _offsetTable[point.y * _numColumns + point.x];
 
-	return newPoint;
+	return Common::Point(sourceOffset % _numColumns, sourceOffset / _numColumns);
 }
 
 void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect) {
-	uint32 destOffset = 0;
-
 	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
-		uint32 sourceOffset = y * _numColumns;
-
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
+		const int32 *sourceOffsets = _offsetTable + y * _numColumns + subRect.left;
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+		for (int16 x = 0; x < subRect.width(); ++x)
+			destBuffer[x] = sourceBuffer[sourceOffsets[x]];
 
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-		}
-
-		destOffset += destWidth;
+		destBuffer += destWidth;
 	}
 }
 
 void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf) {
-	uint32 destOffset = 0;
-
 	uint16 *sourceBuffer = (uint16 *)srcBuf->getPixels();
 	uint16 *destBuffer = (uint16 *)dstBuf->getPixels();
 
 	for (int16 y = 0; y < srcBuf->h; ++y) {
-		uint32 sourceOffset = y * _numColumns;
+		const int32 *sourceOffsets = _offsetTable + y * _numColumns;
+
+		for (int16 x = 0; x < srcBuf->w; ++x)
+			*destBuffer++ = sourceBuffer[sourceOffsets[x]];
+	}
 
-		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
+	_tableChanged = false;
+}
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
+Common::Rect RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &srcDirtyRect) {
+	if (_tableChanged) {
+		mutateImage(dstBuf, srcBuf);
+		return Common::Rect(dstBuf->w, dstBuf->h);
+	}
 
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-			destOffset++;
+	if (srcDirtyRect.isEmpty())
+		return Common::Rect();
+
+	// Every destination pixel reads from within the span of its column and
+	// the span of its row, so only columns and rows whose spans overlap the
+	// dirty rect can change. Scrolling a panorama still dirties everything,
+	// since the cylinder warp is not shift invariant.
+	int16 left = -1, right = -1;
+	for (uint x = 0; x < _numColumns; ++x) {
+		if (_columnSpans[x].last >= srcDirtyRect.left && _columnSpans[x].first < srcDirtyRect.right) {
+			if (left < 0)
+				left = x;
+			right = x + 1;
+		}
+	}
+
+	int16 top = -1, bottom = -1;
+	for (uint y = 0; y < _numRows; ++y) {
+		if (_rowSpans[y].last >= srcDirtyRect.top && _rowSpans[y].first < srcDirtyRect.bottom) {
+			if (top < 0)
+				top = y;
+			bottom = y + 1;
 		}
 	}
+
+	if (left < 0 || top < 0)
+		return Common::Rect();
+
+	Common::Rect destRect(left, top, right, bottom);
+	mutateImage((uint16 *)srcBuf->getPixels(), (uint16 *)dstBuf->getBasePtr(left, top), dstBuf->pitch / 2, destRect);
+
+	return destRect;
+}
+
+void RenderTable::resetSourceSpans() {
+	for (uint x = 0; x < _numColumns; ++x) {
+		_columnSpans[x].first = 0x7FFF;
+		_columnSpans[x].last = -1;
+	}
+
+	for (uint y = 0; y < _numRows; ++y) {
+		_rowSpans[y].first = 0x7FFF;
+		_rowSpans[y].last = -1;
+	}
+}
+
+void RenderTable::setSource(uint x, uint y, int32 sourceX, int32 sourceY) {
+	_offsetTable[y * _numColumns + x] = sourceY * _numColumns + sourceX;
+
+	SourceSpan &column = _columnSpans[x];
+	column.first = MIN<int16>(column.first, sourceX);
+	column.last = MAX<int16>(column.last, sourceX);
+
+	SourceSpan &row = _rowSpans[y];
+	row.first = MIN<int16>(row.first, sourceY);
+	row.last = MAX<int16>(row.last, sourceY);
 }
 
 void RenderTable::generateRenderTable() {
+	_tableChanged = true;
+
 	switch (_renderState) {
 	case ZVision::RenderTable::PANORAMA:
 		generatePanoramaLookupTable();
@@ -139,7 +194,7 @@ void RenderTable::generateRenderTable() {
 }
 
 void RenderTable::generatePanoramaLookupTable() {
-	memset(_internalBuffer, 0, _numRows * _numColumns * sizeof(uint16));
+	resetSourceSpans();
 
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
@@ -163,11 +218,7 @@ void RenderTable::generatePanoramaLookupTable() {
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
 			int32 yInCylinderCoords = int32(floor(halfHeight + ((float)y - halfHeight) * cosAlpha));
 
-			uint32 index = y * _numColumns + x;
-
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			setSource(x, y, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
@@ -180,6 +231,8 @@ void RenderTable::generateTiltLookupTable() {
 	float cylinderRadius = halfWidth / tan(fovInRadians);
 	_tiltOptions.gap = cylinderRadius * atan2((float)(halfHeight / cylinderRadius), 1.0f) * _tiltOptions.linearScale;
 
+	resetSourceSpans();
+
 	for (uint y = 0; y < _numRows; ++y) {
 
 		// Add an offset of 0.01 to overcome zero tan/atan issue (horizontal line on half of screen)
@@ -191,18 +244,13 @@ void RenderTable::generateTiltLookupTable() {
 		int32 yInCylinderCoords = int32(floor((cylinderRadius * _tiltOptions.linearScale * alpha) + halfHeight));
 
 		float cosAlpha = cos(alpha);
-		uint32 columnIndex = y * _numColumns;
 
 		for (uint x = 0; x < _numColumns; ++x) {
 			// To calculate x in cylinder coordinates, we can do similar triangles comparison,
 			// comparing the triangle from the center to the screen and from the center to the edge of the cylinder
 			int32 xInCylinderCoords = int32(floor(halfWidth + ((float)x - halfWidth) * cosAlpha));
 
-			uint32 index = columnIndex + x;
-
-			// Only store the (x,y) offsets instead of the absolute positions
-			_internalBuffer[index].x = xInCylinderCoords - x;
-			_internalBuffer[index].y = yInCylinderCoords - y;
+			setSource(x, y, xInCylinderCoords, yInCylinderCoords);
 		}
 	}
 }
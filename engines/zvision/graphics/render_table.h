@@ -23,6 +23,7 @@
 #ifndef ZVISION_RENDER_TABLE_H
 #define ZVISION_RENDER_TABLE_H
 
+#include "common/array.h"
 #include "common/rect.h"
 #include "graphics/surface.h"
 
@@ -42,9 +43,22 @@ public:
 
 private:
 	uint _numColumns, _numRows;
-	Common::Point *_internalBuffer;
+	/**
+	 * Absolute source offset (y * _numColumns + x) of every destination
+	 * pixel, stored in destination order so warping is a single linear pass
+	 */
+	int32 *_offsetTable;
 	RenderState _renderState;
 
+	/** Range of source columns / rows read by one destination column / row */
+	struct SourceSpan {
+		int16 first, last;
+	};
+	Common::Array<SourceSpan> _columnSpans;
+	Common::Array<SourceSpan> _rowSpans;
+	/** The table changed since the last mutateImage(), the whole image has to be warped again */
+	bool _tableChanged;
+
 	struct {
 		float fieldOfView;
 		float linearScale;
@@ -70,6 +84,12 @@ public:
 
 	void mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 destWidth, const Common::Rect &subRect);
 	void mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf);
+	/**
+	 * Warps only the destination pixels that read from srcDirtyRect
+	 *
+	 * @return	the part of dstBuf that was updated
+	 */
+	Common::Rect mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcBuf, const Common::Rect &srcDirtyRect);
 	void generateRenderTable();
 
 	void setPanoramaFoV(float fov);
@@ -90,6 +110,8 @@ public:
 private:
 	void generatePanoramaLookupTable();
 	void generateTiltLookupTable();
+	void resetSourceSpans();
+	void setSource(uint x, uint y, int32 sourceX, int32 sourceY);
 };
 
 } // End of namespace ZVision
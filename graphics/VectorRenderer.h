@@ -273,6 +273,8 @@ public:
 		_activeSurface = surface;
 	}
 
+	Surface *getSurface() const { return _activeSurface; }
+
 	/**
 	 * Fills the active surface with the specified fg/bg color or the active gradient.
 	 * Defaults to using the active Foreground color for filling.
@@ -427,6 +429,28 @@ public:
 	 */
 	virtual void drawStep(const Common::Rect &area, const DrawStep &step, uint32 extra = 0);
 
+	/**
+	 * Sets up the renderer for the specified draw step, like drawStep()
+	 * does, without drawing anything.
+	 *
+	 * @param step Pointer to a DrawStep struct.
+	 */
+	void setupStep(const DrawStep &step, uint32 extra = 0);
+
+	/**
+	 * The colors used by draw steps which don't specify their own.
+	 */
+	struct ColorState {
+		uint32 fg, bg, bevel, gradientStart, gradientEnd;
+
+		bool operator==(const ColorState &other) const {
+			return fg == other.fg && bg == other.bg && bevel == other.bevel &&
+			       gradientStart == other.gradientStart && gradientEnd == other.gradientEnd;
+		}
+	};
+
+	virtual ColorState getColorState() const = 0;
+
 	/**
 	 * Copies the part of the current frame to the system overlay.
 	 *
@@ -483,6 +507,7 @@ public:
 	 */
 	virtual void disableShadows() { _disableShadows = true; }
 	virtual void enableShadows() { _disableShadows = false; }
+	bool shadowsEnabled() const { return !_disableShadows; }
 
 	/**
 	 * Applies a whole-screen shading effect, used before opening a new dialog.
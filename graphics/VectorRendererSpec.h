@@ -68,6 +68,16 @@ public:
 	void setBevelColor(uint8 r, uint8 g, uint8 b) { _bevelColor = _format.RGBToColor(r, g, b); }
 	void setGradientColors(uint8 r1, uint8 g1, uint8 b1, uint8 r2, uint8 g2, uint8 b2);
 
+	ColorState getColorState() const {
+		ColorState state;
+		state.fg = _fgColor;
+		state.bg = _bgColor;
+		state.bevel = _bevelColor;
+		state.gradientStart = _gradientStart;
+		state.gradientEnd = _gradientEnd;
+		return state;
+	}
+
 	void copyFrame(OSystem *sys, const Common::Rect &r);
 	void copyWholeFrame(OSystem *sys) { copyFrame(sys, Common::Rect(0, 0, _activeSurface->w, _activeSurface->h)); }
 
@@ -25,6 +25,11 @@
 
 #include "common/endian.h"
 
+#if defined(__SSE2__) && defined(SCUMM_LITTLE_ENDIAN)
+#include <emmintrin.h>
+#define CONVERSION_SSE2
+#endif
+
 namespace Graphics {
 
 // TODO: YUV to RGB conversion function
@@ -96,6 +101,284 @@ inline void crossBlitLogic3BppSource(byte *dst, const byte *src, const uint w, c
 	}
 }
 
+/**
+ * A pixel format known at compile time. Conversions between two of these
+ * don't have to look up shifts and losses for every pixel.
+ */
+template<int bytesPerPixel, int rBits, int gBits, int bBits, int aBits,
+         int rShift, int gShift, int bShift, int aShift>
+struct FixedPixelFormat {
+	enum {
+		kBytesPerPixel = bytesPerPixel,
+		kRBits = rBits, kGBits = gBits, kBBits = bBits, kABits = aBits,
+		kRShift = rShift, kGShift = gShift, kBShift = bShift, kAShift = aShift
+	};
+
+	static PixelFormat get() {
+		return PixelFormat(bytesPerPixel, rBits, gBits, bBits, aBits, rShift, gShift, bShift, aShift);
+	}
+
+	static inline void colorToARGB(uint32 color, byte &a, byte &r, byte &g, byte &b) {
+		a = (aBits == 0) ? 0xFF : ColorComponent<aBits>::expand(color >> aShift);
+		r = ColorComponent<rBits>::expand(color >> rShift);
+		g = ColorComponent<gBits>::expand(color >> gShift);
+		b = ColorComponent<bBits>::expand(color >> bShift);
+	}
+
+	static inline uint32 ARGBToColor(byte a, byte r, byte g, byte b) {
+		return ((a >> (8 - aBits)) << aShift) |
+		       ((r >> (8 - rBits)) << rShift) |
+		       ((g >> (8 - gBits)) << gShift) |
+		       ((b >> (8 - bBits)) << bShift);
+	}
+};
+
+typedef FixedPixelFormat<2, 5, 6, 5, 0, 11,  5,  0,  0> FormatRGB565;
+typedef FixedPixelFormat<2, 5, 6, 5, 0,  0,  5, 11,  0> FormatBGR565;
+typedef FixedPixelFormat<2, 5, 5, 5, 0, 10,  5,  0,  0> FormatRGB555;
+typedef FixedPixelFormat<4, 8, 8, 8, 8, 16,  8,  0, 24> FormatARGB8888;
+typedef FixedPixelFormat<4, 8, 8, 8, 8, 24, 16,  8,  0> FormatRGBA8888;
+typedef FixedPixelFormat<4, 8, 8, 8, 8,  0,  8, 16, 24> FormatABGR8888;
+typedef FixedPixelFormat<4, 8, 8, 8, 8,  8, 16, 24,  0> FormatBGRA8888;
+
+enum FixedFormatType {
+	kFormatRGB565,
+	kFormatBGR565,
+	kFormatRGB555,
+	kFormatARGB8888,
+	kFormatRGBA8888,
+	kFormatABGR8888,
+	kFormatBGRA8888,
+	kFormatOther
+};
+
+FixedFormatType getFixedFormatType(const PixelFormat &format) {
+	if (format == FormatRGB565::get())
+		return kFormatRGB565;
+	if (format == FormatBGR565::get())
+		return kFormatBGR565;
+	if (format == FormatRGB555::get())
+		return kFormatRGB555;
+	if (format == FormatARGB8888::get())
+		return kFormatARGB8888;
+	if (format == FormatRGBA8888::get())
+		return kFormatRGBA8888;
+	if (format == FormatABGR8888::get())
+		return kFormatABGR8888;
+	if (format == FormatBGRA8888::get())
+		return kFormatBGRA8888;
+	return kFormatOther;
+}
+
+template<int bytesPerPixel>
+struct FixedPixelType {
+};
+
+template<>
+struct FixedPixelType<2> {
+	typedef uint16 Type;
+};
+
+template<>
+struct FixedPixelType<4> {
+	typedef uint32 Type;
+};
+
+/**
+ * Converts a group of pixels at once. The generic version has no vector
+ * code and converts nothing, specializations set kPixels to the number of
+ * pixels convert() handles.
+ */
+template<typename SrcFormat, typename DstFormat,
+         int srcBpp = SrcFormat::kBytesPerPixel, int dstBpp = DstFormat::kBytesPerPixel>
+struct VectorConverter {
+	enum { kPixels = 0 };
+
+	static inline void convert(void *dst, const void *src) {}
+};
+
+#ifdef CONVERSION_SSE2
+
+// Same as ColorComponent<bits>::expand() on already masked values, only
+// valid for 4 to 8 bits
+template<int bits>
+inline __m128i expandComponentSSE2(__m128i value) {
+	return _mm_or_si128(_mm_slli_epi32(value, 8 - bits), _mm_srli_epi32(value, 2 * bits - 8));
+}
+
+template<>
+inline __m128i expandComponentSSE2<8>(__m128i value) {
+	return value;
+}
+
+template<int bits, int shift>
+inline __m128i extractComponentSSE2(__m128i color) {
+	const __m128i mask = _mm_set1_epi32((1 << bits) - 1);
+	return expandComponentSSE2<bits>(_mm_and_si128(_mm_srli_epi32(color, shift), mask));
+}
+
+template<int bits, int shift>
+inline __m128i packComponentSSE2(__m128i value) {
+	return _mm_slli_epi32(_mm_srli_epi32(value, 8 - bits), shift);
+}
+
+// Converts four pixels stored in 32 bit lanes
+template<typename SrcFormat, typename DstFormat>
+inline __m128i convertPixelsSSE2(__m128i color) {
+	const __m128i r = extractComponentSSE2<SrcFormat::kRBits, SrcFormat::kRShift>(color);
+	const __m128i g = extractComponentSSE2<SrcFormat::kGBits, SrcFormat::kGShift>(color);
+	const __m128i b = extractComponentSSE2<SrcFormat::kBBits, SrcFormat::kBShift>(color);
+	__m128i result = _mm_or_si128(_mm_or_si128(
+		packComponentSSE2<DstFormat::kRBits, DstFormat::kRShift>(r),
+		packComponentSSE2<DstFormat::kGBits, DstFormat::kGShift>(g)),
+		packComponentSSE2<DstFormat::kBBits, DstFormat::kBShift>(b));
+
+	if (DstFormat::kABits != 0) {
+		if (SrcFormat::kABits != 0) {
+			// The fallback bit count only keeps the unused branch compiling
+			const __m128i a = extractComponentSSE2<SrcFormat::kABits != 0 ? SrcFormat::kABits : 8, SrcFormat::kAShift>(color);
+			result = _mm_or_si128(result, packComponentSSE2<DstFormat::kABits, DstFormat::kAShift>(a));
+		} else {
+			result = _mm_or_si128(result, _mm_set1_epi32((0xFF >> (8 - DstFormat::kABits)) << DstFormat::kAShift));
+		}
+	}
+
+	return result;
+}
+
+template<typename SrcFormat, typename DstFormat>
+struct VectorConverter<SrcFormat, DstFormat, 2, 4> {
+	enum { kPixels = 8 };
+
+	static inline void convert(void *dst, const void *src) {
+		const __m128i color = _mm_loadu_si128((const __m128i *)src);
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i lo = convertPixelsSSE2<SrcFormat, DstFormat>(_mm_unpacklo_epi16(color, zero));
+		const __m128i hi = convertPixelsSSE2<SrcFormat, DstFormat>(_mm_unpackhi_epi16(color, zero));
+		_mm_storeu_si128((__m128i *)dst, lo);
+		_mm_storeu_si128((__m128i *)dst + 1, hi);
+	}
+};
+
+template<typename SrcFormat, typename DstFormat>
+struct VectorConverter<SrcFormat, DstFormat, 4, 4> {
+	enum { kPixels = 4 };
+
+	static inline void convert(void *dst, const void *src) {
+		const __m128i color = _mm_loadu_si128((const __m128i *)src);
+		_mm_storeu_si128((__m128i *)dst, convertPixelsSSE2<SrcFormat, DstFormat>(color));
+	}
+};
+
+#endif
+
+template<typename SrcFormat, typename DstFormat>
+inline typename FixedPixelType<DstFormat::kBytesPerPixel>::Type convertPixel(uint32 color) {
+	byte a, r, g, b;
+	SrcFormat::colorToARGB(color, a, r, g, b);
+	return DstFormat::ARGBToColor(a, r, g, b);
+}
+
+template<typename SrcFormat, typename DstFormat>
+void crossBlitFixed(byte *dst, const byte *src, const uint dstPitch, const uint srcPitch,
+                    const uint w, const uint h) {
+	typedef typename FixedPixelType<SrcFormat::kBytesPerPixel>::Type SrcColor;
+	typedef typename FixedPixelType<DstFormat::kBytesPerPixel>::Type DstColor;
+	typedef VectorConverter<SrcFormat, DstFormat> Vector;
+
+	// Like in crossBlit, blit from bottom right to top left when the
+	// destination pixels are larger, so in place conversion works.
+	const bool backward = (int)DstFormat::kBytesPerPixel > (int)SrcFormat::kBytesPerPixel;
+
+	for (uint i = 0; i < h; ++i) {
+		const uint y = backward ? h - 1 - i : i;
+		const SrcColor *srcRow = (const SrcColor *)(src + y * srcPitch);
+		DstColor *dstRow = (DstColor *)(dst + y * dstPitch);
+
+		if (backward) {
+			uint x = w;
+			if (Vector::kPixels != 0) {
+				while (x >= (uint)Vector::kPixels) {
+					x -= Vector::kPixels;
+					Vector::convert(dstRow + x, srcRow + x);
+				}
+			}
+			while (x--)
+				dstRow[x] = convertPixel<SrcFormat, DstFormat>(srcRow[x]);
+		} else {
+			uint x = 0;
+			if (Vector::kPixels != 0) {
+				for (; x + Vector::kPixels <= w; x += Vector::kPixels)
+					Vector::convert(dstRow + x, srcRow + x);
+			}
+			for (; x < w; ++x)
+				dstRow[x] = convertPixel<SrcFormat, DstFormat>(srcRow[x]);
+		}
+	}
+}
+
+template<typename SrcFormat>
+bool crossBlitFixedDst(byte *dst, const byte *src, const uint dstPitch, const uint srcPitch,
+                       const uint w, const uint h, FixedFormatType dstType) {
+	switch (dstType) {
+	case kFormatRGB565:
+		crossBlitFixed<SrcFormat, FormatRGB565>(dst, src, dstPitch, srcPitch, w, h);
+		return true;
+	case kFormatBGR565:
+		crossBlitFixed<SrcFormat, FormatBGR565>(dst, src, dstPitch, srcPitch, w, h);
+		return true;
+	case kFormatRGB555:
+		crossBlitFixed<SrcFormat, FormatRGB555>(dst, src, dstPitch, srcPitch, w, h);
+		return true;
+	case kFormatARGB8888:
+		crossBlitFixed<SrcFormat, FormatARGB8888>(dst, src, dstPitch, srcPitch, w, h);
+		return true;
+	case kFormatRGBA8888:
+		crossBlitFixed<SrcFormat, FormatRGBA8888>(dst, src, dstPitch, srcPitch, w, h);
+		return true;
+	case kFormatABGR8888:
+		crossBlitFixed<SrcFormat, FormatABGR8888>(dst, src, dstPitch, srcPitch, w, h);
+		return true;
+	case kFormatBGRA8888:
+		crossBlitFixed<SrcFormat, FormatBGRA8888>(dst, src, dstPitch, srcPitch, w, h);
+		return true;
+	default:
+		return false;
+	}
+}
+
+/**
+ * Converts between the most common pixel formats with conversion code
+ * specialized for each pair.
+ *
+ * @return false if either format isn't one of the fixed formats
+ */
+bool crossBlitFixedFormats(byte *dst, const byte *src, const uint dstPitch, const uint srcPitch,
+                           const uint w, const uint h, const PixelFormat &dstFmt, const PixelFormat &srcFmt) {
+	const FixedFormatType dstType = getFixedFormatType(dstFmt);
+	if (dstType == kFormatOther)
+		return false;
+
+	switch (getFixedFormatType(srcFmt)) {
+	case kFormatRGB565:
+		return crossBlitFixedDst<FormatRGB565>(dst, src, dstPitch, srcPitch, w, h, dstType);
+	case kFormatBGR565:
+		return crossBlitFixedDst<FormatBGR565>(dst, src, dstPitch, srcPitch, w, h, dstType);
+	case kFormatRGB555:
+		return crossBlitFixedDst<FormatRGB555>(dst, src, dstPitch, srcPitch, w, h, dstType);
+	case kFormatARGB8888:
+		return crossBlitFixedDst<FormatARGB8888>(dst, src, dstPitch, srcPitch, w, h, dstType);
+	case kFormatRGBA8888:
+		return crossBlitFixedDst<FormatRGBA8888>(dst, src, dstPitch, srcPitch, w, h, dstType);
+	case kFormatABGR8888:
+		return crossBlitFixedDst<FormatABGR8888>(dst, src, dstPitch, srcPitch, w, h, dstType);
+	case kFormatBGRA8888:
+		return crossBlitFixedDst<FormatBGRA8888>(dst, src, dstPitch, srcPitch, w, h, dstType);
+	default:
+		return false;
+	}
+}
+
 } // End of anonymous namespace
 
 // Function to blit a rect from one color format to another
@@ -126,6 +409,9 @@ bool crossBlit(byte *dst, const byte *src,
 		return true;
 	}
 
+	if (crossBlitFixedFormats(dst, src, dstPitch, srcPitch, w, h, dstFmt, srcFmt))
+		return true;
+
 	// Faster, but larger, to provide optimized handling for each case.
 	const uint srcDelta = (srcPitch - w * srcFmt.bytesPerPixel);
 	const uint dstDelta = (dstPitch - w * dstFmt.bytesPerPixel);
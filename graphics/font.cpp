@@ -39,7 +39,7 @@ namespace {
 
 template<class StringType>
 Common::Rect getBoundingBoxImpl(const Font &font, const StringType &str, int x, int y, int w, TextAlign align, int deltax) {
-	// We follow the logic of drawStringImpl here. The only exception is
+	// We follow the logic of drawString here. The only exception is
 	// that we do allow an empty width to be specified here. This allows us
 	// to obtain the complete bounding box of a string.
 	const int leftX = x, rightX = w ? (x + w) : 0x7FFFFFFF;
@@ -93,20 +93,19 @@ int getStringWidthImpl(const Font &font, const StringType &str) {
 }
 
 template<class StringType>
-void drawStringImpl(const Font &font, Surface *dst, const StringType &str, int x, int y, int w, uint32 color, TextAlign align, int deltax) {
+int getStringStartX(const Font &font, const StringType &str, int x, int w, TextAlign align, int deltax) {
 	// The logic in getBoundingImpl is the same as we use here. In case we
 	// ever change something here we will need to change it there too.
-	assert(dst != 0);
-
-	const int leftX = x, rightX = x + w;
-	int width = font.getStringWidth(str);
-
 	if (align == kTextAlignCenter)
-		x = x + (w - width)/2;
+		x = x + (w - font.getStringWidth(str))/2;
 	else if (align == kTextAlignRight)
-		x = x + w - width;
-	x += deltax;
+		x = x + w - font.getStringWidth(str);
+	return x + deltax;
+}
 
+template<class StringType>
+void drawStringRunImpl(const Font &font, Surface *dst, const StringType &str, int x, int y, int leftX, int rightX, uint32 color) {
+	int w;
 	typename StringType::unsigned_type last = 0;
 	for (typename StringType::const_iterator i = str.begin(), end = str.end(); i != end; ++i) {
 		const typename StringType::unsigned_type cur = *i;
@@ -265,12 +264,22 @@ int Font::getStringWidth(const Common::U32String &str) const {
 }
 
 void Font::drawString(Surface *dst, const Common::String &str, int x, int y, int w, uint32 color, TextAlign align, int deltax, bool useEllipsis) const {
+	assert(dst != 0);
 	Common::String renderStr = useEllipsis ? handleEllipsis(str, w) : str;
-	drawStringImpl(*this, dst, renderStr, x, y, w, color, align, deltax);
+	drawStringRun(dst, renderStr, getStringStartX(*this, renderStr, x, w, align, deltax), y, x, x + w, color);
 }
 
 void Font::drawString(Surface *dst, const Common::U32String &str, int x, int y, int w, uint32 color, TextAlign align) const {
-	drawStringImpl(*this, dst, str, x, y, w, color, align, 0);
+	assert(dst != 0);
+	drawStringRun(dst, str, getStringStartX(*this, str, x, w, align, 0), y, x, x + w, color);
+}
+
+void Font::drawStringRun(Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color) const {
+	drawStringRunImpl(*this, dst, str, x, y, leftX, rightX, color);
+}
+
+void Font::drawStringRun(Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color) const {
+	drawStringRunImpl(*this, dst, str, x, y, leftX, rightX, color);
 }
 
 int Font::wordWrapText(const Common::String &str, int maxWidth, Common::Array<Common::String> &lines) const {
@@ -173,6 +173,17 @@ public:
 	int wordWrapText(const Common::String &str, int maxWidth, Common::Array<Common::String> &lines) const;
 	int wordWrapText(const Common::U32String &str, int maxWidth, Common::Array<Common::U32String> &lines) const;
 
+protected:
+	/**
+	 * Draw the characters of a string starting at x, skipping those left of
+	 * leftX and stopping at the first one which ends right of rightX. This
+	 * is called by drawString after it applied the alignment. The default
+	 * implementation calls drawChar for each character; fonts which can
+	 * draw a whole run faster than that should override it.
+	 */
+	virtual void drawStringRun(Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color) const;
+	virtual void drawStringRun(Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color) const;
+
 private:
 	Common::String handleEllipsis(const Common::String &str, int w) const;
 };
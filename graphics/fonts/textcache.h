@@ -0,0 +1,184 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef GRAPHICS_FONTS_TEXTCACHE_H
+#define GRAPHICS_FONTS_TEXTCACHE_H
+
+#include "common/func.h"
+#include "common/hashmap.h"
+#include "common/noncopyable.h"
+
+namespace Graphics {
+
+/**
+ * A cache of rendered texts, which evicts the least recently used ones once
+ * the total size of the cached renderings exceeds a configurable limit.
+ *
+ * The key holds everything the rendering depends on, e.g. the text, the
+ * width it is wrapped to and its alignment. The rendering can be anything
+ * the text has been rendered to, like a Surface or a texture of the engine.
+ * The cache owns the renderings and deletes them when they are evicted.
+ */
+template<class Key, class Rendering, class HashFunc = Common::Hash<Key>, class EqualFunc = Common::EqualTo<Key> >
+class TextCache : Common::NonCopyable {
+public:
+	/**
+	 * Create a cache.
+	 *
+	 * @param maxSize The limit for the total size of the cached renderings,
+	 *                in the unit the sizes passed to put() use (usually
+	 *                bytes).
+	 */
+	explicit TextCache(uint32 maxSize = 1024 * 1024) : _maxSize(maxSize), _size(0), _useCounter(0) {}
+	~TextCache() { clear(); }
+
+	/**
+	 * Return the rendering cached for a key, or 0 if there is none. The
+	 * rendering becomes the most recently used one.
+	 */
+	Rendering *get(const Key &key) {
+		typename EntryMap::iterator i = _entries.find(key);
+		if (i == _entries.end())
+			return 0;
+
+		i->_value.lastUse = ++_useCounter;
+		i->_value.used = true;
+		return i->_value.rendering;
+	}
+
+	/**
+	 * Add the rendering of a key, replacing the rendering cached for it so
+	 * far. Least recently used renderings are evicted until the new one fits
+	 * into the limit. A rendering larger than the limit is still cached, on
+	 * its own, until the next one is added.
+	 *
+	 * @param key       The key of the rendering.
+	 * @param rendering The rendering, which is owned by the cache afterwards.
+	 * @param size      The size of the rendering.
+	 */
+	void put(const Key &key, Rendering *rendering, uint32 size) {
+		Entry &entry = _entries[key];
+		if (entry.rendering) {
+			_size -= entry.size;
+			delete entry.rendering;
+		}
+
+		entry.rendering = rendering;
+		entry.size = size;
+		entry.lastUse = ++_useCounter;
+		entry.used = true;
+		_size += size;
+
+		shrink();
+	}
+
+	/**
+	 * Remove and delete the rendering cached for a key, if there is one.
+	 */
+	void remove(const Key &key) {
+		typename EntryMap::iterator i = _entries.find(key);
+		if (i != _entries.end())
+			erase(i);
+	}
+
+	/**
+	 * Remove and delete all renderings which have not been used (by get or
+	 * put) since the last call. This allows to keep only the texts of the
+	 * current frame when memory is short.
+	 */
+	void purgeUnused() {
+		for (typename EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i) {
+			if (i->_value.used)
+				i->_value.used = false;
+			else
+				erase(i);
+		}
+	}
+
+	/**
+	 * Remove and delete all cached renderings.
+	 */
+	void clear() {
+		for (typename EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i)
+			delete i->_value.rendering;
+		_entries.clear();
+		_size = 0;
+	}
+
+	/**
+	 * Change the limit for the total size of the cached renderings, evicting
+	 * renderings if they exceed the new limit.
+	 */
+	void setMaxSize(uint32 maxSize) {
+		_maxSize = maxSize;
+		shrink();
+	}
+
+	uint32 getMaxSize() const { return _maxSize; }
+
+	/** Return the total size of the cached renderings. */
+	uint32 getSize() const { return _size; }
+
+	/** Return the number of cached renderings. */
+	uint getCount() const { return _entries.size(); }
+
+private:
+	struct Entry {
+		Entry() : rendering(0), size(0), lastUse(0), used(false) {}
+
+		Rendering *rendering;
+		uint32 size;
+		uint32 lastUse;
+		bool used;
+	};
+
+	typedef Common::HashMap<Key, Entry, HashFunc, EqualFunc> EntryMap;
+
+	EntryMap _entries;
+	uint32 _maxSize;
+	uint32 _size;
+	uint32 _useCounter;
+
+	void erase(typename EntryMap::iterator i) {
+		_size -= i->_value.size;
+		delete i->_value.rendering;
+		_entries.erase(i);
+	}
+
+	void shrink() {
+		// Lookups are what the cache is there for, so they only stamp the
+		// entries. The least recently used one is searched for when
+		// evicting. The most recently used entry always stays.
+		while (_size > _maxSize && _entries.size() > 1) {
+			typename EntryMap::iterator oldest = _entries.begin();
+			for (typename EntryMap::iterator i = _entries.begin(); i != _entries.end(); ++i) {
+				if (i->_value.lastUse < oldest->_value.lastUse)
+					oldest = i;
+			}
+			erase(oldest);
+		}
+	}
+};
+
+} // End of namespace Graphics
+
+#endif
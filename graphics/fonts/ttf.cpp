@@ -35,6 +35,7 @@
 #include "common/stream.h"
 #include "common/memstream.h"
 #include "common/hashmap.h"
+#include "common/array.h"
 #include "common/ptr.h"
 
 #include <ft2build.h>
@@ -122,6 +123,11 @@ public:
 	virtual Common::Rect getBoundingBox(uint32 chr) const;
 
 	virtual void drawChar(Surface *dst, uint32 chr, int x, int y, uint32 color) const;
+
+protected:
+	virtual void drawStringRun(Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color) const;
+	virtual void drawStringRun(Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color) const;
+
 private:
 	bool _initialized;
 	FT_Face _face;
@@ -139,11 +145,53 @@ private:
 		FT_UInt slot;
 	};
 
-	bool cacheGlyph(Glyph &glyph, uint32 chr) const;
-	typedef Common::HashMap<uint32, Glyph> GlyphCache;
-	mutable GlyphCache _glyphs;
+	enum GlyphState {
+		kGlyphUnknown = 0,
+		kGlyphCached,
+		kGlyphMissing
+	};
+
+	struct GlyphEntry {
+		GlyphEntry() : state(kGlyphUnknown) {}
+
+		Glyph glyph;
+		GlyphState state;
+	};
+
+	enum {
+		kGlyphPageCount = 256,
+		kGlyphPageSize = 256,
+		kAtlasPageSize = 256
+	};
+
+	// Glyphs of the Basic Multilingual Plane are looked up in pages of 256
+	// characters, allocated on first use. Characters beyond that go into a
+	// hash map. Characters the font has no glyph for are remembered too.
+	mutable GlyphEntry *_glyphPages[kGlyphPageCount];
+	typedef Common::HashMap<uint32, GlyphEntry> GlyphCache;
+	mutable GlyphCache _otherGlyphs;
 	bool _allowLateCaching;
-	void assureCached(uint32 chr) const;
+
+	GlyphEntry &getGlyphEntry(uint32 chr) const;
+	const Glyph *getGlyph(uint32 chr) const;
+	bool cacheGlyph(Glyph &glyph, uint32 chr) const;
+
+	// Glyph images are areas of a few larger atlas surfaces, which are
+	// filled row by row, instead of separate surfaces.
+	mutable Common::Array<Surface *> _atlasPages;
+	mutable int _atlasX, _atlasY, _atlasRowHeight;
+	void allocateGlyphImage(Surface &image, int w, int h) const;
+
+	// Kerning offsets by the glyph slots of the left and right character
+	typedef Common::HashMap<uint32, int> KerningCache;
+	mutable KerningCache _kerningCache;
+	int getSlotKerningOffset(FT_UInt leftSlot, FT_UInt rightSlot) const;
+
+	// Runs of characters look every glyph up once, and only clip glyphs
+	// which are not completely inside the surface.
+	template<class StringType>
+	void drawGlyphRun(Surface *dst, const StringType &str, int x, int y, int leftX, int rightX, uint32 color) const;
+	void drawGlyph(Surface *dst, const Glyph &glyph, int x, int y, uint32 color) const;
 
 	Common::SeekableReadStream *readTTFTable(FT_ULong tag) const;
 
@@ -158,8 +206,10 @@ private:
 
 TTFFont::TTFFont()
     : _initialized(false), _face(), _ttfFile(0), _size(0), _width(0), _height(0), _ascent(0),
-      _descent(0), _glyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
-      _hasKerning(false), _allowLateCaching(false) {
+      _descent(0), _otherGlyphs(), _loadFlags(FT_LOAD_TARGET_NORMAL), _renderMode(FT_RENDER_MODE_NORMAL),
+      _hasKerning(false), _allowLateCaching(false), _atlasX(0), _atlasY(0), _atlasRowHeight(0) {
+	for (int i = 0; i < kGlyphPageCount; ++i)
+		_glyphPages[i] = 0;
 }
 
 TTFFont::~TTFFont() {
@@ -169,11 +219,16 @@ TTFFont::~TTFFont() {
 		delete[] _ttfFile;
 		_ttfFile = 0;
 
-		for (GlyphCache::iterator i = _glyphs.begin(), end = _glyphs.end(); i != end; ++i)
-			i->_value.image.free();
-
 		_initialized = false;
 	}
+
+	for (int i = 0; i < kGlyphPageCount; ++i)
+		delete[] _glyphPages[i];
+
+	for (uint i = 0; i < _atlasPages.size(); ++i) {
+		_atlasPages[i]->free();
+		delete _atlasPages[i];
+	}
 }
 
 bool TTFFont::load(Common::SeekableReadStream &stream, int size, TTFSizeMode sizeMode, uint dpi, TTFRenderMode renderMode, const uint32 *mapping) {
@@ -245,14 +300,20 @@ bool TTFFont::load(Common::SeekableReadStream &stream, int size, TTFSizeMode siz
 	_width = ftCeil26_6(FT_MulFix(_face->max_advance_width, _face->size->metrics.x_scale));
 	_height = _ascent - _descent + 1;
 
+	uint cachedGlyphs = 0;
+
 	if (!mapping) {
 		// Allow loading of all unicode characters.
 		_allowLateCaching = true;
 
 		// Load all ISO-8859-1 characters.
 		for (uint i = 0; i < 256; ++i) {
-			if (!cacheGlyph(_glyphs[i], i)) {
-				_glyphs.erase(i);
+			GlyphEntry &entry = getGlyphEntry(i);
+			if (cacheGlyph(entry.glyph, i)) {
+				entry.state = kGlyphCached;
+				++cachedGlyphs;
+			} else {
+				entry.state = kGlyphMissing;
 			}
 		}
 	} else {
@@ -264,15 +325,19 @@ bool TTFFont::load(Common::SeekableReadStream &stream, int size, TTFSizeMode siz
 			const bool isRequired = (mapping[i] & 0x80000000) != 0;
 			// Check whether loading an important glyph fails and error out if
 			// that is the case.
-			if (!cacheGlyph(_glyphs[i], unicode)) {
-				_glyphs.erase(i);
+			GlyphEntry &entry = getGlyphEntry(i);
+			if (cacheGlyph(entry.glyph, unicode)) {
+				entry.state = kGlyphCached;
+				++cachedGlyphs;
+			} else {
+				entry.state = kGlyphMissing;
 				if (isRequired)
 					return false;
 			}
 		}
 	}
 
-	_initialized = (_glyphs.size() != 0);
+	_initialized = (cachedGlyphs != 0);
 	return _initialized;
 }
 
@@ -405,55 +470,59 @@ int TTFFont::getMaxCharWidth() const {
 }
 
 int TTFFont::getCharWidth(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
+	const Glyph *glyph = getGlyph(chr);
+	if (!glyph)
 		return 0;
 	else
-		return glyphEntry->_value.advance;
+		return glyph->advance;
 }
 
 int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!_hasKerning)
 		return 0;
 
-	assureCached(left);
-	assureCached(right);
+	const Glyph *glyph;
 
-	FT_UInt leftGlyph, rightGlyph;
-	GlyphCache::const_iterator glyphEntry;
-
-	glyphEntry = _glyphs.find(left);
-	if (glyphEntry != _glyphs.end()) {
-		leftGlyph = glyphEntry->_value.slot;
-	} else {
+	glyph = getGlyph(left);
+	if (!glyph)
 		return 0;
-	}
+	const FT_UInt leftGlyph = glyph->slot;
 
-	glyphEntry = _glyphs.find(right);
-	if (glyphEntry != _glyphs.end()) {
-		rightGlyph = glyphEntry->_value.slot;
-	} else {
+	glyph = getGlyph(right);
+	if (!glyph)
 		return 0;
-	}
+	const FT_UInt rightGlyph = glyph->slot;
 
+	return getSlotKerningOffset(leftGlyph, rightGlyph);
+}
+
+int TTFFont::getSlotKerningOffset(FT_UInt leftGlyph, FT_UInt rightGlyph) const {
 	if (!leftGlyph || !rightGlyph)
 		return 0;
 
 	FT_Vector kerningVector;
+	if (leftGlyph > 0xFFFF || rightGlyph > 0xFFFF) {
+		FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
+		return (kerningVector.x / 64);
+	}
+
+	const uint32 key = (leftGlyph << 16) | rightGlyph;
+	KerningCache::const_iterator kerning = _kerningCache.find(key);
+	if (kerning != _kerningCache.end())
+		return kerning->_value;
+
 	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
-	return (kerningVector.x / 64);
+	return _kerningCache[key] = (kerningVector.x / 64);
 }
 
 Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end()) {
+	const Glyph *glyph = getGlyph(chr);
+	if (!glyph) {
 		return Common::Rect();
 	} else {
-		const int xOffset = glyphEntry->_value.xOffset;
-		const int yOffset = glyphEntry->_value.yOffset;
-		const Graphics::Surface &image = glyphEntry->_value.image;
+		const int xOffset = glyph->xOffset;
+		const int yOffset = glyph->yOffset;
+		const Graphics::Surface &image = glyph->image;
 		return Common::Rect(xOffset, yOffset, xOffset + image.w, yOffset + image.h);
 	}
 }
@@ -461,7 +530,11 @@ Common::Rect TTFFont::getBoundingBox(uint32 chr) const {
 namespace {
 
 template<typename ColorType>
-void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos, const int srcPitch, const int w, const int h, ColorType color, const PixelFormat &dstFormat) {
+void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos, const int srcPitch, const int w, const int h, ColorType color, const PixelFormat &format) {
+	// Work on a copy of the format: it would have to be reloaded after each
+	// pixel written otherwise, since its byte members may alias the surface.
+	const PixelFormat dstFormat = format;
+
 	uint8 sR, sG, sB;
 	dstFormat.colorToRGB(color, sR, sG, sB);
 
@@ -497,49 +570,80 @@ void renderGlyph(uint8 *dstPos, const int dstPitch, const uint8 *srcPos, const i
 } // End of anonymous namespace
 
 void TTFFont::drawChar(Surface *dst, uint32 chr, int x, int y, uint32 color) const {
-	assureCached(chr);
-	GlyphCache::const_iterator glyphEntry = _glyphs.find(chr);
-	if (glyphEntry == _glyphs.end())
-		return;
+	const Glyph *glyph = getGlyph(chr);
+	if (glyph)
+		drawGlyph(dst, *glyph, x, y, color);
+}
+
+void TTFFont::drawStringRun(Surface *dst, const Common::String &str, int x, int y, int leftX, int rightX, uint32 color) const {
+	drawGlyphRun(dst, str, x, y, leftX, rightX, color);
+}
+
+void TTFFont::drawStringRun(Surface *dst, const Common::U32String &str, int x, int y, int leftX, int rightX, uint32 color) const {
+	drawGlyphRun(dst, str, x, y, leftX, rightX, color);
+}
+
+template<class StringType>
+void TTFFont::drawGlyphRun(Surface *dst, const StringType &str, int x, int y, int leftX, int rightX, uint32 color) const {
+	// This follows the per character loop of Font::drawStringRun, but with
+	// one glyph lookup per character instead of one each for kerning, width
+	// and drawing.
+	FT_UInt lastSlot = 0;
+
+	for (typename StringType::const_iterator i = str.begin(), end = str.end(); i != end; ++i) {
+		const Glyph *glyph = getGlyph((typename StringType::unsigned_type)*i);
+		if (!glyph) {
+			// Characters without a glyph have no width and no kerning.
+			if (x > rightX)
+				break;
+			lastSlot = 0;
+			continue;
+		}
 
-	const Glyph &glyph = glyphEntry->_value;
+		if (_hasKerning)
+			x += getSlotKerningOffset(lastSlot, glyph->slot);
+		lastSlot = glyph->slot;
 
+		const int w = glyph->advance;
+		if (x + w > rightX)
+			break;
+		if (x + w >= leftX)
+			drawGlyph(dst, *glyph, x, y, color);
+		x += w;
+	}
+}
+
+void TTFFont::drawGlyph(Surface *dst, const Glyph &glyph, int x, int y, uint32 color) const {
 	x += glyph.xOffset;
 	y += glyph.yOffset;
 
-	if (x > dst->w)
-		return;
-	if (y > dst->h)
-		return;
-
 	int w = glyph.image.w;
 	int h = glyph.image.h;
 
 	const uint8 *srcPos = (const uint8 *)glyph.image.getPixels();
 
-	// Make sure we are not drawing outside the screen bounds
-	if (x < 0) {
-		srcPos -= x;
-		w += x;
-		x = 0;
-	}
+	if (x < 0 || y < 0 || x + w > dst->w || y + h > dst->h) {
+		// Make sure we are not drawing outside the screen bounds
+		if (x < 0) {
+			srcPos -= x;
+			w += x;
+			x = 0;
+		}
 
-	if (x + w > dst->w)
-		w = dst->w - x;
+		if (x + w > dst->w)
+			w = dst->w - x;
 
-	if (w <= 0)
-		return;
+		if (y < 0) {
+			srcPos -= y * glyph.image.pitch;
+			h += y;
+			y = 0;
+		}
 
-	if (y < 0) {
-		srcPos -= y * glyph.image.pitch;
-		h += y;
-		y = 0;
+		if (y + h > dst->h)
+			h = dst->h - y;
 	}
 
-	if (y + h > dst->h)
-		h = dst->h - y;
-
-	if (h <= 0)
+	if (w <= 0 || h <= 0)
 		return;
 
 	uint8 *dstPos = (uint8 *)dst->getBasePtr(x, y);
@@ -594,7 +698,12 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 	glyph.advance = ftCeil26_6(_face->glyph->advance.x);
 
 	const FT_Bitmap &bitmap = _face->glyph->bitmap;
-	glyph.image.create(bitmap.width, bitmap.rows, PixelFormat::createFormatCLUT8());
+	if (bitmap.pixel_mode != FT_PIXEL_MODE_MONO && bitmap.pixel_mode != FT_PIXEL_MODE_GRAY) {
+		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap.pixel_mode);
+		return false;
+	}
+
+	allocateGlyphImage(glyph.image, bitmap.width, bitmap.rows);
 
 	const uint8 *src = bitmap.buffer;
 	int srcPitch = bitmap.pitch;
@@ -603,11 +712,10 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 		srcPitch = -srcPitch;
 	}
 
+	// The atlas area is still cleared, so only set pixels need writing.
 	uint8 *dst = (uint8 *)glyph.image.getPixels();
-	memset(dst, 0, glyph.image.h * glyph.image.pitch);
 
-	switch (bitmap.pixel_mode) {
-	case FT_PIXEL_MODE_MONO:
+	if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO) {
 		for (int y = 0; y < (int)bitmap.rows; ++y) {
 			const uint8 *curSrc = src;
 			uint8 mask = 0;
@@ -617,42 +725,79 @@ bool TTFFont::cacheGlyph(Glyph &glyph, uint32 chr) const {
 					mask = *curSrc++;
 
 				if (mask & 0x80)
-					*dst = 255;
+					dst[x] = 255;
 
 				mask <<= 1;
-				++dst;
 			}
 
+			dst += glyph.image.pitch;
 			src += srcPitch;
 		}
-		break;
-
-	case FT_PIXEL_MODE_GRAY:
+	} else {
 		for (int y = 0; y < (int)bitmap.rows; ++y) {
 			memcpy(dst, src, bitmap.width);
 			dst += glyph.image.pitch;
 			src += srcPitch;
 		}
-		break;
-
-	default:
-		warning("TTFFont::cacheGlyph: Unsupported pixel mode %d", bitmap.pixel_mode);
-		glyph.image.free();
-		return false;
 	}
 
 	return true;
 }
 
-void TTFFont::assureCached(uint32 chr) const {
-	if (!chr || !_allowLateCaching || _glyphs.contains(chr)) {
+void TTFFont::allocateGlyphImage(Surface &image, int w, int h) const {
+	if (w <= 0 || h <= 0) {
+		image = Surface();
+		image.format = PixelFormat::createFormatCLUT8();
 		return;
 	}
 
-	Glyph newGlyph;
-	if (cacheGlyph(newGlyph, chr)) {
-		_glyphs[chr] = newGlyph;
+	Surface *page = _atlasPages.empty() ? 0 : _atlasPages.back();
+
+	// Start a new row when the glyph does not fit into the current one
+	if (page && _atlasX + w > page->w) {
+		_atlasX = 0;
+		_atlasY += _atlasRowHeight;
+		_atlasRowHeight = 0;
+	}
+
+	if (!page || _atlasX + w > page->w || _atlasY + h > page->h) {
+		page = new Surface();
+		page->create(MAX<int>(kAtlasPageSize, w), MAX<int>(kAtlasPageSize, h), PixelFormat::createFormatCLUT8());
+		_atlasPages.push_back(page);
+
+		_atlasX = 0;
+		_atlasY = 0;
+		_atlasRowHeight = 0;
 	}
+
+	image = page->getSubArea(Common::Rect(_atlasX, _atlasY, _atlasX + w, _atlasY + h));
+
+	_atlasX += w;
+	_atlasRowHeight = MAX(_atlasRowHeight, h);
+}
+
+TTFFont::GlyphEntry &TTFFont::getGlyphEntry(uint32 chr) const {
+	if (chr >= kGlyphPageCount * kGlyphPageSize)
+		return _otherGlyphs[chr];
+
+	GlyphEntry *&page = _glyphPages[chr / kGlyphPageSize];
+	if (!page)
+		page = new GlyphEntry[kGlyphPageSize];
+
+	return page[chr % kGlyphPageSize];
+}
+
+const TTFFont::Glyph *TTFFont::getGlyph(uint32 chr) const {
+	GlyphEntry &entry = getGlyphEntry(chr);
+
+	if (entry.state == kGlyphUnknown) {
+		if (chr && _allowLateCaching && cacheGlyph(entry.glyph, chr))
+			entry.state = kGlyphCached;
+		else
+			entry.state = kGlyphMissing;
+	}
+
+	return (entry.state == kGlyphCached) ? &entry.glyph : 0;
 }
 
 Font *loadTTFFont(Common::SeekableReadStream &stream, int size, TTFSizeMode sizeMode, uint dpi, TTFRenderMode renderMode, const uint32 *mapping) {
@@ -37,6 +37,11 @@
 #include "graphics/transparent_surface.h"
 #include "graphics/transform_tools.h"
 
+#if defined(__SSE2__) && defined(SCUMM_LITTLE_ENDIAN)
+#include <emmintrin.h>
+#define TRANSPARENT_SURFACE_SSE2
+#endif
+
 //#define ENABLE_BILINEAR
 
 namespace Graphics {
@@ -82,6 +87,135 @@ TransparentSurface::TransparentSurface(const Surface &surf, bool copyData) : Sur
 	}
 }
 
+#ifdef TRANSPARENT_SURFACE_SSE2
+
+/*
+ * SSE2 versions of the blending inner loops. Each of them handles a row in
+ * groups of 4 pixels and returns the number of pixels it blended, the rest of
+ * the row is left to the scalar code. They produce exactly the same results as
+ * the scalar loops below, which is why some of the arithmetic looks roundabout.
+ *
+ * Pixels are unpacked to 16 bits per channel, with the alpha channel in the
+ * lowest lane of every pixel (kAIndex == 0 on little endian).
+ */
+
+static inline __m128i splatAlpha(__m128i px) {
+	px = _mm_shufflelo_epi16(px, _MM_SHUFFLE(0, 0, 0, 0));
+	return _mm_shufflehi_epi16(px, _MM_SHUFFLE(0, 0, 0, 0));
+}
+
+static inline __m128i colorModVector(uint32 color) {
+	return _mm_set_epi16((color >> kRModShift) & 0xFF, (color >> kGModShift) & 0xFF, (color >> kBModShift) & 0xFF, 0,
+	                     (color >> kRModShift) & 0xFF, (color >> kGModShift) & 0xFF, (color >> kBModShift) & 0xFF, 0);
+}
+
+static uint32 blitAlphaBlendRowSSE2(const byte *in, byte *out, uint32 width) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32(0xFF << (kAIndex * 8));
+	const __m128i ff = _mm_set1_epi16(0xFF);
+	uint32 j = 0;
+	for (; j + 4 <= width; j += 4, in += 16, out += 16) {
+		__m128i src = _mm_loadu_si128((const __m128i *)in);
+		__m128i dst = _mm_loadu_si128((const __m128i *)out);
+
+		__m128i s = _mm_unpacklo_epi8(src, zero);
+		__m128i d = _mm_unpacklo_epi8(dst, zero);
+		__m128i a = splatAlpha(s);
+		__m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d, _mm_sub_epi16(ff, a))), 8);
+
+		s = _mm_unpackhi_epi8(src, zero);
+		d = _mm_unpackhi_epi8(dst, zero);
+		a = splatAlpha(s);
+		__m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d, _mm_sub_epi16(ff, a))), 8);
+
+		__m128i res = _mm_or_si128(_mm_packus_epi16(lo, hi), alphaMask);
+		// Fully transparent source pixels leave the target untouched
+		__m128i transparent = _mm_cmpeq_epi32(_mm_and_si128(src, alphaMask), zero);
+		res = _mm_or_si128(_mm_and_si128(transparent, dst), _mm_andnot_si128(transparent, res));
+		_mm_storeu_si128((__m128i *)out, res);
+	}
+	return j;
+}
+
+static uint32 blitAlphaBlendColorRowSSE2(const byte *in, byte *out, uint32 width, uint32 color) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i alphaMask = _mm_set1_epi32(0xFF << (kAIndex * 8));
+	const __m128i ff = _mm_set1_epi16(0xFF);
+	const __m128i ca = _mm_set1_epi16((color >> kAModShift) & 0xFF);
+	const __m128i mod = colorModVector(color);
+	uint32 j = 0;
+	for (; j + 4 <= width; j += 4, in += 16, out += 16) {
+		__m128i src = _mm_loadu_si128((const __m128i *)in);
+		__m128i dst = _mm_loadu_si128((const __m128i *)out);
+		__m128i res[2];
+		for (int half = 0; half < 2; half++) {
+			__m128i s = half ? _mm_unpackhi_epi8(src, zero) : _mm_unpacklo_epi8(src, zero);
+			__m128i d = half ? _mm_unpackhi_epi8(dst, zero) : _mm_unpacklo_epi8(dst, zero);
+			__m128i ina = _mm_srli_epi16(_mm_mullo_epi16(splatAlpha(s), ca), 8);
+			d = _mm_srli_epi16(_mm_mullo_epi16(d, _mm_sub_epi16(ff, ina)), 8);
+			// (in * ina * mod) >> 16, in * ina still fits in 16 bits
+			__m128i add = _mm_mulhi_epu16(_mm_mullo_epi16(s, ina), mod);
+			res[half] = _mm_and_si128(_mm_add_epi16(d, add), ff);
+		}
+		_mm_storeu_si128((__m128i *)out, _mm_or_si128(_mm_packus_epi16(res[0], res[1]), alphaMask));
+	}
+	return j;
+}
+
+static uint32 blitAdditiveBlendRowSSE2(const byte *in, byte *out, uint32 width, uint32 color) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i colorMask = _mm_set1_epi32(~(0xFF << (kAIndex * 8)));
+	const __m128i ca = _mm_set1_epi16((color >> kAModShift) & 0xFF);
+	const __m128i mod = colorModVector(color);
+	// Channels with a color mod of 255 skip the multiplication in the scalar code
+	const __m128i fullChannel = _mm_cmpeq_epi16(mod, _mm_set1_epi16(0xFF));
+	const bool noMod = (color == 0xFFFFFFFF);
+	uint32 j = 0;
+	for (; j + 4 <= width; j += 4, in += 16, out += 16) {
+		__m128i src = _mm_loadu_si128((const __m128i *)in);
+		__m128i dst = _mm_loadu_si128((const __m128i *)out);
+		__m128i add[2];
+		for (int half = 0; half < 2; half++) {
+			__m128i s = half ? _mm_unpackhi_epi8(src, zero) : _mm_unpacklo_epi8(src, zero);
+			__m128i a = splatAlpha(s);
+			if (noMod) {
+				add[half] = _mm_srli_epi16(_mm_mullo_epi16(s, a), 8);
+			} else {
+				__m128i ina = _mm_srli_epi16(_mm_mullo_epi16(a, ca), 8);
+				__m128i x = _mm_mullo_epi16(s, ina);
+				add[half] = _mm_or_si128(_mm_and_si128(fullChannel, _mm_srli_epi16(x, 8)),
+				                         _mm_andnot_si128(fullChannel, _mm_mulhi_epu16(x, mod)));
+			}
+		}
+		// The alpha channel of the target is left alone
+		__m128i sum = _mm_and_si128(_mm_packus_epi16(add[0], add[1]), colorMask);
+		_mm_storeu_si128((__m128i *)out, _mm_adds_epu8(dst, sum));
+	}
+	return j;
+}
+
+static uint32 blitSubtractiveBlendRowSSE2(const byte *in, byte *out, uint32 width) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i colorLanes = _mm_set_epi16(-1, -1, -1, 0, -1, -1, -1, 0);
+	uint32 j = 0;
+	for (; j + 4 <= width; j += 4, in += 16, out += 16) {
+		__m128i src = _mm_loadu_si128((const __m128i *)in);
+		__m128i dst = _mm_loadu_si128((const __m128i *)out);
+		__m128i res[2];
+		for (int half = 0; half < 2; half++) {
+			__m128i s = half ? _mm_unpackhi_epi8(src, zero) : _mm_unpacklo_epi8(src, zero);
+			__m128i d = half ? _mm_unpackhi_epi8(dst, zero) : _mm_unpacklo_epi8(dst, zero);
+			// ((in * out) * a) >> 16, never more than out itself
+			__m128i sub = _mm_mulhi_epu16(_mm_mullo_epi16(s, d), splatAlpha(s));
+			res[half] = _mm_sub_epi16(d, _mm_and_si128(sub, colorLanes));
+		}
+		_mm_storeu_si128((__m128i *)out, _mm_packus_epi16(res[0], res[1]));
+	}
+	return j;
+}
+
+#endif // TRANSPARENT_SURFACE_SSE2
+
 /**
  * Optimized version of doBlit to be used w/opaque blitting (no alpha).
  */
@@ -150,7 +284,15 @@ void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+#ifdef TRANSPARENT_SURFACE_SSE2
+			if (inStep == 4) {
+				j = blitAlphaBlendRowSSE2(in, out, width);
+				in += j * 4;
+				out += j * 4;
+			}
+#endif
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kAIndex] = 255;
@@ -175,7 +317,15 @@ void doBlitAlphaBlend(byte *ino, byte *outo, uint32 width, uint32 height, uint32
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+#ifdef TRANSPARENT_SURFACE_SSE2
+			if (inStep == 4) {
+				j = blitAlphaBlendColorRowSSE2(in, out, width, color);
+				in += j * 4;
+				out += j * 4;
+			}
+#endif
+			for (; j < width; j++) {
 
 				uint32 ina = in[kAIndex] * ca >> 8;
 				out[kAIndex] = 255;
@@ -208,7 +358,15 @@ void doBlitAdditiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+#ifdef TRANSPARENT_SURFACE_SSE2
+			if (inStep == 4) {
+				j = blitAdditiveBlendRowSSE2(in, out, width, color);
+				in += j * 4;
+				out += j * 4;
+			}
+#endif
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kRIndex] = MIN((in[kRIndex] * in[kAIndex] >> 8) + out[kRIndex], 255);
@@ -232,7 +390,15 @@ void doBlitAdditiveBlend(byte *ino, byte *outo, uint32 width, uint32 height, uin
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+#ifdef TRANSPARENT_SURFACE_SSE2
+			if (inStep == 4) {
+				j = blitAdditiveBlendRowSSE2(in, out, width, color);
+				in += j * 4;
+				out += j * 4;
+			}
+#endif
+			for (; j < width; j++) {
 
 				uint32 ina = in[kAIndex] * ca >> 8;
 
@@ -275,7 +441,15 @@ void doBlitSubtractiveBlend(byte *ino, byte *outo, uint32 width, uint32 height,
 		for (uint32 i = 0; i < height; i++) {
 			out = outo;
 			in = ino;
-			for (uint32 j = 0; j < width; j++) {
+			uint32 j = 0;
+#ifdef TRANSPARENT_SURFACE_SSE2
+			if (inStep == 4) {
+				j = blitSubtractiveBlendRowSSE2(in, out, width);
+				in += j * 4;
+				out += j * 4;
+			}
+#endif
+			for (; j < width; j++) {
 
 				if (in[kAIndex] != 0) {
 					out[kRIndex] = MAX(out[kRIndex] - ((in[kRIndex] * out[kRIndex]) * in[kAIndex] >> 16), 0);
@@ -155,6 +155,33 @@ protected:
 	bool _alpha;
 };
 
+/**
+ * A DrawData item as drawn by ThemeEngine::drawDrawData(). Draw steps blend
+ * with what is already on the surface, so besides the drawing itself the
+ * pixels it was drawn on are kept, and the drawing is only reused on the
+ * very same pixels.
+ */
+struct CachedDrawData {
+	const WidgetDrawData *data;
+	Common::Rect area;
+	Common::Rect drawnArea;
+	uint32 dynamic;
+	Graphics::VectorRenderer::ColorState colors;
+	bool shadows;
+
+	Graphics::Surface before; ///< Surface contents in drawnArea before drawing
+	Graphics::Surface after;  ///< Surface contents in drawnArea after drawing
+
+	~CachedDrawData() {
+		before.free();
+		after.free();
+	}
+
+	uint32 getSize() const {
+		return before.pitch * before.h + after.pitch * after.h;
+	}
+};
+
 
 
 /**********************************************************
@@ -233,11 +260,8 @@ void ThemeItemDrawData::drawSelf(bool draw, bool restore) {
 	if (restore)
 		_engine->restoreBackground(extendedRect);
 
-	if (draw) {
-		Common::List<Graphics::DrawStep>::const_iterator step;
-		for (step = _data->_steps.begin(); step != _data->_steps.end(); ++step)
-			_engine->renderer()->drawStep(_area, *step, _dynamicData);
-	}
+	if (draw)
+		_engine->drawDrawData(_data, _area, extendedRect, _dynamicData);
 
 	_engine->addDirtyRect(extendedRect);
 }
@@ -276,7 +300,7 @@ void ThemeItemBitmap::drawSelf(bool draw, bool restore) {
 ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(0), _vectorRenderer(0),
 	_buffering(false), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
-	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
+	_font(0), _drawDataCacheSize(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
 	_cursor(0) {
 
 	_system = g_system;
@@ -316,6 +340,8 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 }
 
 ThemeEngine::~ThemeEngine() {
+	clearDrawDataCache();
+
 	delete _vectorRenderer;
 	_vectorRenderer = 0;
 	_screen.free();
@@ -520,6 +546,8 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	_screen.free();
 	_screen.create(width, height, _overlayFormat);
 
+	clearDrawDataCache();
+
 	delete _vectorRenderer;
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
@@ -550,6 +578,106 @@ void ThemeEngine::restoreBackground(Common::Rect r) {
 	_vectorRenderer->blitSurface(&_backBuffer, r);
 }
 
+static bool hasSamePixels(const Graphics::Surface &cached, const Graphics::Surface &surface, const Common::Rect &r) {
+	const uint rowSize = r.width() * surface.format.bytesPerPixel;
+	for (int y = 0; y < r.height(); ++y) {
+		if (memcmp(cached.getBasePtr(0, y), surface.getBasePtr(r.left, r.top + y), rowSize))
+			return false;
+	}
+	return true;
+}
+
+static void copyPixels(Graphics::Surface &cached, const Graphics::Surface &surface, const Common::Rect &r) {
+	if (!cached.getPixels())
+		cached.create(r.width(), r.height(), surface.format);
+	cached.copyRectToSurface(surface, 0, 0, r);
+}
+
+void ThemeEngine::drawDrawData(const WidgetDrawData *data, const Common::Rect &area, const Common::Rect &drawnArea, uint32 dynamic) {
+	Graphics::Surface *surface = _vectorRenderer->getSurface();
+	Common::Rect r = drawnArea;
+	r.clip(surface->w, surface->h);
+
+	const uint32 size = r.width() * r.height() * surface->format.bytesPerPixel * 2;
+	const uint32 pixels = r.width() * r.height();
+
+	// Huge items like dialog backgrounds would push everything else out of
+	// the cache, so they are always drawn
+	if (r.isEmpty() || size > kDrawDataCacheMaxSize / 4) {
+		for (Common::List<Graphics::DrawStep>::const_iterator step = data->_steps.begin(); step != data->_steps.end(); ++step)
+			_vectorRenderer->drawStep(area, *step, dynamic);
+
+		_drawDataCacheStats.misses++;
+		_drawDataCacheStats.pixelsDrawn += pixels;
+		return;
+	}
+
+	const Graphics::VectorRenderer::ColorState colors = _vectorRenderer->getColorState();
+	const bool shadows = _vectorRenderer->shadowsEnabled();
+
+	for (Common::List<CachedDrawData *>::iterator i = _drawDataCache.begin(); i != _drawDataCache.end(); ++i) {
+		CachedDrawData *cached = *i;
+		if (cached->data != data || cached->area != area || cached->drawnArea != r || cached->dynamic != dynamic
+		        || !(cached->colors == colors) || cached->shadows != shadows || !hasSamePixels(cached->before, *surface, r))
+			continue;
+
+		surface->copyRectToSurface(cached->after, r.left, r.top, Common::Rect(r.width(), r.height()));
+
+		// Leave the renderer in the state drawing the steps would have left
+		// it in, later items may depend on it
+		for (Common::List<Graphics::DrawStep>::const_iterator step = data->_steps.begin(); step != data->_steps.end(); ++step)
+			_vectorRenderer->setupStep(*step, dynamic);
+
+		_drawDataCache.erase(i);
+		_drawDataCache.push_front(cached);
+
+		_drawDataCacheStats.hits++;
+		_drawDataCacheStats.pixelsCopied += pixels;
+		return;
+	}
+
+	CachedDrawData *cached = new CachedDrawData();
+	cached->data = data;
+	cached->area = area;
+	cached->drawnArea = r;
+	cached->dynamic = dynamic;
+	cached->colors = colors;
+	cached->shadows = shadows;
+
+	copyPixels(cached->before, *surface, r);
+	for (Common::List<Graphics::DrawStep>::const_iterator step = data->_steps.begin(); step != data->_steps.end(); ++step)
+		_vectorRenderer->drawStep(area, *step, dynamic);
+	copyPixels(cached->after, *surface, r);
+
+	_drawDataCache.push_front(cached);
+	_drawDataCacheSize += cached->getSize();
+
+	while (_drawDataCacheSize > kDrawDataCacheMaxSize) {
+		CachedDrawData *last = _drawDataCache.back();
+		_drawDataCache.pop_back();
+		_drawDataCacheSize -= last->getSize();
+		delete last;
+	}
+
+	_drawDataCacheStats.misses++;
+	_drawDataCacheStats.pixelsDrawn += pixels;
+}
+
+void ThemeEngine::clearDrawDataCache() {
+	if (_drawDataCacheStats.hits || _drawDataCacheStats.misses) {
+		debug(3, "ThemeEngine: DrawData cache: %d hits (%d pixels), %d misses (%d pixels), %d ms drawing",
+		      _drawDataCacheStats.hits, _drawDataCacheStats.pixelsCopied,
+		      _drawDataCacheStats.misses, _drawDataCacheStats.pixelsDrawn, _drawDataCacheStats.drawTime);
+	}
+
+	for (Common::List<CachedDrawData *>::iterator i = _drawDataCache.begin(); i != _drawDataCache.end(); ++i)
+		delete *i;
+
+	_drawDataCache.clear();
+	_drawDataCacheSize = 0;
+	_drawDataCacheStats.reset();
+}
+
 
 
 /**********************************************************
@@ -713,6 +841,8 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	clearDrawDataCache();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = 0;
@@ -1235,6 +1365,8 @@ void ThemeEngine::debugWidgetPosition(const char *name, const Common::Rect &r) {
  * Screen/overlay management
  *********************************************************/
 void ThemeEngine::updateScreen(bool render) {
+	const uint32 drawStart = _system->getMillis();
+
 	if (!_bufferQueue.empty()) {
 		_vectorRenderer->setSurface(&_backBuffer);
 
@@ -1259,6 +1391,8 @@ void ThemeEngine::updateScreen(bool render) {
 		_screenQueue.clear();
 	}
 
+	_drawDataCacheStats.drawTime += _system->getMillis() - drawStart;
+
 	if (render)
 		renderDirtyScreen();
 }
@@ -48,6 +48,7 @@ class VectorRenderer;
 namespace GUI {
 
 struct WidgetDrawData;
+struct CachedDrawData;
 struct TextDrawData;
 struct TextColorData;
 class Dialog;
@@ -523,6 +524,31 @@ public:
 	 */
 	void restoreBackground(Common::Rect r);
 
+	/**
+	 * Draws all steps of a DrawData item on the active surface. When the
+	 * same item was drawn on the same pixels before, the result is copied
+	 * from the DrawData cache instead.
+	 *
+	 * @param data DrawData item to draw.
+	 * @param area Area to draw the item in.
+	 * @param drawnArea Area the steps of the item may change.
+	 * @param dynamic Dynamic data for the draw steps.
+	 */
+	void drawDrawData(const WidgetDrawData *data, const Common::Rect &area, const Common::Rect &drawnArea, uint32 dynamic);
+
+	struct DrawDataCacheStats {
+		uint32 hits;         ///< DrawData items copied from the cache
+		uint32 misses;       ///< DrawData items drawn
+		uint32 pixelsCopied;
+		uint32 pixelsDrawn;
+		uint32 drawTime;     ///< Milliseconds spent on drawing queued items
+
+		DrawDataCacheStats() { reset(); }
+		void reset() { hits = misses = pixelsCopied = pixelsDrawn = drawTime = 0; }
+	};
+
+	const DrawDataCacheStats &getDrawDataCacheStats() const { return _drawDataCacheStats; }
+
 	const Common::String &getThemeName() const { return _themeName; }
 	const Common::String &getThemeId() const { return _themeId; }
 	int getGraphicsMode() const { return _graphicsMode; }
@@ -538,6 +564,12 @@ protected:
 	 */
 	template<typename PixelType> void screenInit(bool backBuffer = true);
 
+	/**
+	 * Frees all drawings in the DrawData cache. Needs to be done whenever
+	 * the DrawData items or the screen surfaces change.
+	 */
+	void clearDrawDataCache();
+
 	/**
 	 * Loads the given theme into the ThemeEngine.
 	 *
@@ -673,6 +705,15 @@ protected:
 	/** Queue with all the drawing that must be done to the screen */
 	Common::List<ThemeItem *> _screenQueue;
 
+	enum {
+		kDrawDataCacheMaxSize = 4 * 1024 * 1024 ///< Bytes of pixels kept in the DrawData cache
+	};
+
+	/** Recently drawn DrawData items, most recently used first */
+	Common::List<CachedDrawData *> _drawDataCache;
+	uint32 _drawDataCacheSize;
+	DrawDataCacheStats _drawDataCacheStats;
+
 	bool _initOk;  ///< Class and renderer properly initialized
 	bool _themeOk; ///< Theme data successfully loaded.
 	bool _enabled; ///< Whether the Theme is currently shown on the overlay
@@ -729,11 +729,23 @@ void LauncherDialog::close() {
 	Dialog::close();
 }
 
+struct LauncherEntry {
+	Common::String key;
+	Common::String description;
+
+	LauncherEntry(const Common::String &k, const Common::String &d) : key(k), description(d) {}
+};
+
+struct LauncherEntryComparator {
+	bool operator()(const LauncherEntry &x, const LauncherEntry &y) const {
+		return scumm_stricmp(x.description.c_str(), y.description.c_str()) < 0;
+	}
+};
+
 void LauncherDialog::updateListing() {
-	StringArray l;
+	Common::Array<LauncherEntry> entries;
 
 	// Retrieve a list of all games defined in the config file
-	_domains.clear();
 	const ConfigManager::DomainMap &domains = ConfMan.getGameDomains();
 	ConfigManager::DomainMap::const_iterator iter;
 	for (iter = domains.begin(); iter != domains.end(); ++iter) {
@@ -762,15 +774,23 @@ void LauncherDialog::updateListing() {
 
 		if (!gameid.empty() && !description.empty()) {
 			// Insert the game into the launcher list
-			int pos = 0, size = l.size();
-
-			while (pos < size && (scumm_stricmp(description.c_str(), l[pos].c_str()) > 0))
-				pos++;
-			l.insert_at(pos, description);
-			_domains.insert_at(pos, iter->_key);
+			entries.push_back(LauncherEntry(iter->_key, description));
 		}
 	}
 
+	// Sort the list by description, all at once instead of inserting every
+	// game at its place, which gets slow with many games
+	Common::sort(entries.begin(), entries.end(), LauncherEntryComparator());
+
+	StringArray l;
+	l.reserve(entries.size());
+	_domains.clear();
+	_domains.reserve(entries.size());
+	for (Common::Array<LauncherEntry>::const_iterator entry = entries.begin(); entry != entries.end(); ++entry) {
+		l.push_back(entry->description);
+		_domains.push_back(entry->key);
+	}
+
 	const int oldSel = _list->getSelected();
 	_list->setList(l);
 	if (oldSel < (int)l.size())
@@ -161,6 +161,11 @@ void ListWidget::setList(const StringArray &list, const ColorList *colors) {
 	_dataList = list;
 	_list = list;
 	_filter.clear();
+
+	_lowercaseDataList = list;
+	for (StringArray::iterator i = _lowercaseDataList.begin(); i != _lowercaseDataList.end(); ++i)
+		i->toLowercase();
+
 	_listIndex.clear();
 	_listColors.clear();
 
@@ -196,6 +201,10 @@ void ListWidget::append(const String &s, ThemeEngine::FontColor color) {
 	_dataList.push_back(s);
 	_list.push_back(s);
 
+	String lowercase = s;
+	lowercase.toLowercase();
+	_lowercaseDataList.push_back(lowercase);
+
 	setFilter(_filter, false);
 
 	scrollBarRecalc();
@@ -679,6 +688,11 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 	if (_filter == filt) // Filter was not changed
 		return;
 
+	// When the filter was only extended at its end, e.g. while typing, its
+	// words are the old ones or longer. Only entries matching the old filter
+	// can match the new one then.
+	const bool narrowing = !_filter.empty() && filt.hasPrefix(_filter);
+
 	_filter = filt;
 
 	if (_filter.empty()) {
@@ -689,27 +703,32 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 		// Restrict the list to everything which contains all words in _filter
 		// as substrings, ignoring case.
 
+		StringArray words;
 		Common::StringTokenizer tok(_filter);
-		String tmp;
-		int n = 0;
+		while (!tok.empty())
+			words.push_back(tok.nextToken());
+
+		Common::Array<int> candidates;
+		if (narrowing)
+			candidates = _listIndex;
+		const uint count = narrowing ? candidates.size() : _dataList.size();
 
 		_list.clear();
 		_listIndex.clear();
 
-		for (StringArray::iterator i = _dataList.begin(); i != _dataList.end(); ++i, ++n) {
-			tmp = *i;
-			tmp.toLowercase();
+		for (uint i = 0; i < count; ++i) {
+			const int n = narrowing ? candidates[i] : i;
+			const String &entry = _lowercaseDataList[n];
 			bool matches = true;
-			tok.reset();
-			while (!tok.empty()) {
-				if (!tmp.contains(tok.nextToken())) {
+			for (uint j = 0; j < words.size(); ++j) {
+				if (!entry.contains(words[j])) {
 					matches = false;
 					break;
 				}
 			}
 
 			if (matches) {
-				_list.push_back(*i);
+				_list.push_back(_dataList[n]);
 				_listIndex.push_back(n);
 			}
 		}
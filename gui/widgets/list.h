@@ -55,6 +55,7 @@ public:
 protected:
 	StringArray		_list;
 	StringArray		_dataList;
+	StringArray		_lowercaseDataList;	///< _dataList in lower case, for filtering
 	ColorList		_listColors;
 	Common::Array<int>		_listIndex;
 	bool			_editable;
@@ -0,0 +1,125 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/util.h"
+#include "audio/softsynth/opl/dbopl.h"
+
+#ifndef DISABLE_DOSBOX_OPL
+
+namespace {
+
+struct RegisterWrite {
+	uint16 reg;
+	uint8 val;
+};
+
+// Register log captured from a typical AdLib/OPL3 music driver start-up:
+// melodic 2-op voices, a 4-op voice pair, rhythm mode and key on/off
+// cycles. A write with reg 0 marks the end of a step, after which a block
+// of samples is rendered.
+const RegisterWrite registerLog[] = {
+	{ 0x001, 0x20 }, { 0x105, 0x01 }, { 0x104, 0x01 }, { 0x0bd, 0xc0 },
+	{ 0x020, 0x21 }, { 0x023, 0x21 }, { 0x040, 0x1a }, { 0x043, 0x00 },
+	{ 0x060, 0xf5 }, { 0x063, 0x74 }, { 0x080, 0x33 }, { 0x083, 0x17 },
+	{ 0x0e0, 0x01 }, { 0x0e3, 0x00 }, { 0x0c0, 0x3e },
+	{ 0x028, 0xe1 }, { 0x02b, 0x62 }, { 0x048, 0x8f }, { 0x04b, 0x06 },
+	{ 0x068, 0xa7 }, { 0x06b, 0x65 }, { 0x088, 0x22 }, { 0x08b, 0x48 },
+	{ 0x0e8, 0x02 }, { 0x0eb, 0x03 }, { 0x0c3, 0x31 },
+	{ 0x021, 0x31 }, { 0x024, 0x72 }, { 0x041, 0x4f }, { 0x044, 0x00 },
+	{ 0x061, 0xf2 }, { 0x064, 0x52 }, { 0x081, 0x0b }, { 0x084, 0x0b },
+	{ 0x0e1, 0x05 }, { 0x0e4, 0x06 }, { 0x0c1, 0x3b },
+	{ 0x022, 0x11 }, { 0x025, 0x01 }, { 0x042, 0x8a }, { 0x045, 0x40 },
+	{ 0x062, 0xf1 }, { 0x065, 0xf1 }, { 0x082, 0x11 }, { 0x085, 0xb3 },
+	{ 0x0c2, 0x30 },
+	{ 0x0a0, 0x57 }, { 0x0b0, 0x31 }, { 0x0a3, 0x98 }, { 0x0b3, 0x0d },
+	{ 0x0a1, 0x6b }, { 0x0b1, 0x2d }, { 0x0a2, 0x81 }, { 0x0b2, 0x36 },
+	{ 0x000, 0x00 },
+	{ 0x0a1, 0x02 }, { 0x0b1, 0x32 }, { 0x040, 0x20 }, { 0x0bd, 0x40 },
+	{ 0x000, 0x00 },
+	{ 0x0b0, 0x11 }, { 0x0b1, 0x12 },
+	{ 0x000, 0x00 },
+	{ 0x0b2, 0x16 }, { 0x0a0, 0xca }, { 0x0b0, 0x2e }, { 0x0c0, 0x31 },
+	{ 0x000, 0x00 },
+	{ 0x030, 0x01 }, { 0x033, 0x01 }, { 0x050, 0x0b }, { 0x053, 0x00 },
+	{ 0x070, 0xa8 }, { 0x073, 0xd6 }, { 0x090, 0x4c }, { 0x093, 0x4f },
+	{ 0x031, 0x01 }, { 0x051, 0x00 }, { 0x071, 0xf8 }, { 0x091, 0xb6 },
+	{ 0x032, 0x0e }, { 0x052, 0x00 }, { 0x072, 0xf8 }, { 0x092, 0xb5 },
+	{ 0x034, 0x0c }, { 0x054, 0x00 }, { 0x074, 0xd6 }, { 0x094, 0x4f },
+	{ 0x035, 0x01 }, { 0x055, 0x00 }, { 0x075, 0xf6 }, { 0x095, 0xb5 },
+	{ 0x0c6, 0x30 }, { 0x0c7, 0x30 }, { 0x0c8, 0x30 },
+	{ 0x0a6, 0x57 }, { 0x0b6, 0x09 }, { 0x0a7, 0x03 }, { 0x0b7, 0x0a },
+	{ 0x0a8, 0x57 }, { 0x0b8, 0x0a }, { 0x0bd, 0xff },
+	{ 0x000, 0x00 },
+	{ 0x0bd, 0xe0 }, { 0x0b3, 0x0c }, { 0x0bd, 0xf5 },
+	{ 0x000, 0x00 },
+	{ 0x104, 0x00 }, { 0x0b0, 0x0e }, { 0x0b2, 0x12 }, { 0x0bd, 0xc0 },
+	{ 0x000, 0x00 },
+	{ 0x105, 0x00 }, { 0x0a1, 0x6b }, { 0x0b1, 0x2d },
+	{ 0x000, 0x00 }
+};
+
+uint32 hashSamples(uint32 hash, const int32 *samples, uint count) {
+	// FNV-1a over the raw sample words
+	for (uint i = 0; i < count; ++i) {
+		uint32 v = (uint32)samples[i];
+		for (int b = 0; b < 4; ++b) {
+			hash ^= (v >> (b * 8)) & 0xff;
+			hash *= 16777619;
+		}
+	}
+	return hash;
+}
+
+uint32 renderRegisterLog(uint32 rate, bool opl3, uint samplesPerStep) {
+	using namespace OPL::DOSBox::DBOPL;
+
+	InitTables();
+	Chip *chip = new Chip();
+	chip->Setup(rate);
+
+	int32 *buffer = new int32[samplesPerStep * 2];
+	uint32 hash = 2166136261u;
+
+	for (uint i = 0; i < ARRAYSIZE(registerLog); ++i) {
+		const RegisterWrite &write = registerLog[i];
+		if (write.reg) {
+			if (opl3 || write.reg < 0x100)
+				chip->WriteReg(write.reg, write.val);
+			continue;
+		}
+
+		if (opl3) {
+			chip->GenerateBlock3(samplesPerStep, buffer);
+			hash = hashSamples(hash, buffer, samplesPerStep * 2);
+		} else {
+			chip->GenerateBlock2(samplesPerStep, buffer);
+			hash = hashSamples(hash, buffer, samplesPerStep);
+		}
+	}
+
+	delete[] buffer;
+	delete chip;
+	return hash;
+}
+
+} // End of anonymous namespace
+
+#endif // !DISABLE_DOSBOX_OPL
+
+// Output hashes were recorded with the per-sample DOSBox generator, any
+// optimization of the synthesis loops has to keep them bit-exact.
+class DBOPLTestSuite : public CxxTest::TestSuite {
+public:
+	void test_opl2_register_log() {
+#ifndef DISABLE_DOSBOX_OPL
+		TS_ASSERT_EQUALS(renderRegisterLog(49716, false, 2048), 0x2bbfba06u);
+		TS_ASSERT_EQUALS(renderRegisterLog(22050, false, 1000), 0x250e31c3u);
+#endif
+	}
+
+	void test_opl3_register_log() {
+#ifndef DISABLE_DOSBOX_OPL
+		TS_ASSERT_EQUALS(renderRegisterLog(49716, true, 2048), 0xbcdb6078u);
+		TS_ASSERT_EQUALS(renderRegisterLog(44100, true, 777), 0x59964063u);
+#endif
+	}
+};
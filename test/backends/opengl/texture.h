@@ -0,0 +1,193 @@
+#include <cxxtest/TestSuite.h>
+
+#include "backends/graphics/opengl/texture.h"
+#include "common/array.h"
+#include "common/rect.h"
+
+// Records all uploads into a copy of the texture contents instead of calling
+// OpenGL.
+class MockTextureUploader : public OpenGL::TextureUploader {
+public:
+	MockTextureUploader(uint bytesPerPixel) : _bytesPerPixel(bytesPerPixel), _width(0), _height(0), _names(0) {}
+
+	virtual GLuint createTexture(GLint filter) { return ++_names; }
+	virtual void deleteTexture(GLuint texture) {}
+	virtual void setFilter(GLuint texture, GLint filter) {}
+
+	virtual void allocateStorage(GLuint texture, GLenum glIntFormat, uint width, uint height,
+	                             GLenum glFormat, GLenum glType) {
+		_width = width;
+		_height = height;
+		_contents.clear();
+		_contents.resize(width * height * _bytesPerPixel);
+	}
+
+	virtual void uploadArea(GLuint texture, const Common::Rect &area,
+	                        GLenum glFormat, GLenum glType, const void *pixels) {
+		TS_ASSERT(area.left >= 0 && area.right <= (int16)_width);
+		TS_ASSERT(area.top >= 0 && area.bottom <= (int16)_height);
+
+		const uint rowSize = area.width() * _bytesPerPixel;
+		const byte *src = (const byte *)pixels;
+		for (int y = area.top; y < area.bottom; ++y) {
+			memcpy(&_contents[(y * _width + area.left) * _bytesPerPixel], src, rowSize);
+			src += rowSize;
+		}
+		_areas.push_back(area);
+	}
+
+	uint32 getPixel(uint x, uint y) const {
+		return *(const uint32 *)&_contents[(y * _width + x) * _bytesPerPixel];
+	}
+
+	const uint _bytesPerPixel;
+	uint _width, _height;
+	GLuint _names;
+	Common::Array<byte> _contents;
+	Common::Array<Common::Rect> _areas;
+};
+
+class OpenGLTextureTestSuite : public CxxTest::TestSuite {
+private:
+	static Graphics::PixelFormat format() {
+		return Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24);
+	}
+
+	static void fillPattern(uint32 *buffer, uint count, uint32 seed) {
+		for (uint i = 0; i < count; ++i) {
+			seed = seed * 1103515245 + 12345;
+			buffer[i] = seed;
+		}
+	}
+
+	// The uploaded texture has to match the texture data after every update.
+	static void checkContents(const MockTextureUploader &uploader, const OpenGL::Texture &texture) {
+		const Graphics::Surface *surface = texture.OpenGL::Texture::getSurface();
+		for (int y = 0; y < surface->h; ++y) {
+			for (int x = 0; x < surface->w; ++x) {
+				TS_ASSERT_EQUALS(uploader.getPixel(x, y), *(const uint32 *)surface->getBasePtr(x, y));
+			}
+		}
+	}
+
+public:
+	void test_full_upload() {
+		MockTextureUploader uploader(4);
+		OpenGL::Texture texture(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, format(), &uploader);
+		texture.allocate(100, 50);
+		texture.fill(0x12345678);
+		texture.updateTexture();
+
+		TS_ASSERT(!texture.isDirty());
+		TS_ASSERT_EQUALS(uploader._areas.size(), 1u);
+		TS_ASSERT_EQUALS(texture.getUploadStats().uploads, 1u);
+		TS_ASSERT_EQUALS(texture.getUploadStats().bytesUploaded, uploader._width * 50 * 4);
+		checkContents(uploader, texture);
+	}
+
+	void test_narrow_rect_upload() {
+		MockTextureUploader uploader(4);
+		OpenGL::Texture texture(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, format(), &uploader);
+		texture.allocate(128, 64);
+		texture.fill(0);
+		texture.updateTexture();
+		uploader._areas.clear();
+		texture.resetUploadStats();
+
+		uint32 pixels[10 * 7];
+		fillPattern(pixels, ARRAYSIZE(pixels), 1);
+		texture.copyRectToTexture(20, 30, 10, 7, pixels, 10 * 4);
+		texture.updateTexture();
+
+		// Only the changed pixels are uploaded
+		TS_ASSERT_EQUALS(uploader._areas.size(), 1u);
+		TS_ASSERT_EQUALS(uploader._areas[0], Common::Rect(20, 30, 30, 37));
+		TS_ASSERT_EQUALS(texture.getUploadStats().bytesUploaded, 10u * 7 * 4);
+		checkContents(uploader, texture);
+	}
+
+	void test_wide_rect_upload() {
+		MockTextureUploader uploader(4);
+		OpenGL::Texture texture(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, format(), &uploader);
+		texture.allocate(128, 64);
+		texture.updateTexture();
+		uploader._areas.clear();
+
+		uint32 pixels[100 * 3];
+		fillPattern(pixels, ARRAYSIZE(pixels), 2);
+		texture.copyRectToTexture(10, 5, 100, 3, pixels, 100 * 4);
+		texture.updateTexture();
+
+		// Whole texture lines are uploaded
+		TS_ASSERT_EQUALS(uploader._areas.size(), 1u);
+		TS_ASSERT_EQUALS(uploader._areas[0], Common::Rect(0, 5, 128, 8));
+		checkContents(uploader, texture);
+	}
+
+	void test_dirty_rect_merging() {
+		MockTextureUploader uploader(4);
+		OpenGL::Texture texture(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, format(), &uploader);
+		texture.allocate(256, 256);
+		texture.updateTexture();
+		uploader._areas.clear();
+
+		uint32 pixels[16 * 16];
+		fillPattern(pixels, ARRAYSIZE(pixels), 3);
+
+		// Separate rects are uploaded separately, overlapping ones together
+		texture.copyRectToTexture(0, 0, 16, 16, pixels, 16 * 4);
+		texture.copyRectToTexture(100, 100, 16, 16, pixels, 16 * 4);
+		texture.copyRectToTexture(108, 108, 16, 16, pixels, 16 * 4);
+		texture.updateTexture();
+
+		TS_ASSERT_EQUALS(uploader._areas.size(), 2u);
+		TS_ASSERT_EQUALS(uploader._areas[0], Common::Rect(0, 0, 16, 16));
+		TS_ASSERT_EQUALS(uploader._areas[1], Common::Rect(100, 100, 124, 124));
+		checkContents(uploader, texture);
+
+		// Too many rects are merged into their bounding box
+		uploader._areas.clear();
+		for (uint i = 0; i < 9; ++i) {
+			texture.copyRectToTexture(i * 20, i * 20, 4, 4, pixels, 16 * 4);
+		}
+		texture.updateTexture();
+
+		TS_ASSERT_EQUALS(uploader._areas.size(), 1u);
+		TS_ASSERT_EQUALS(uploader._areas[0], Common::Rect(0, 0, 256, 164));
+		checkContents(uploader, texture);
+	}
+
+	void test_clut8_conversion() {
+		MockTextureUploader uploader(4);
+		OpenGL::TextureCLUT8 texture(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, format(), &uploader);
+		texture.allocate(64, 64);
+
+		byte palette[256 * 3];
+		for (uint i = 0; i < sizeof(palette); ++i) {
+			palette[i] = i * 7;
+		}
+		texture.setPalette(0, 256, palette);
+		texture.updateTexture();
+		TS_ASSERT_EQUALS(texture.getUploadStats().pixelsConverted, 64u * 64);
+		texture.resetUploadStats();
+
+		byte pixels[5 * 6];
+		for (uint i = 0; i < sizeof(pixels); ++i) {
+			pixels[i] = i * 13;
+		}
+		texture.copyRectToTexture(3, 4, 5, 6, pixels, 5);
+		texture.updateTexture();
+
+		// Only the changed pixels are converted
+		TS_ASSERT_EQUALS(texture.getUploadStats().pixelsConverted, 5u * 6);
+		checkContents(uploader, texture);
+
+		const Graphics::PixelFormat fmt = format();
+		for (uint y = 0; y < 6; ++y) {
+			for (uint x = 0; x < 5; ++x) {
+				const byte *color = palette + pixels[y * 5 + x] * 3;
+				TS_ASSERT_EQUALS(uploader.getPixel(3 + x, 4 + y), fmt.RGBToColor(color[0], color[1], color[2]));
+			}
+		}
+	}
+};
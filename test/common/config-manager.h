@@ -0,0 +1,163 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/config-manager.h"
+#include "common/memstream.h"
+
+class ConfigManagerTestSuite : public CxxTest::TestSuite {
+private:
+	void loadConfig(const char *config) {
+		Common::MemoryReadStream stream((const byte *)config, strlen(config));
+		ConfMan.loadFromStream(stream);
+	}
+
+	// The names of the domains in the order they are saved in
+	Common::String savedDomains() {
+		Common::MemoryWriteStreamDynamic buffer(DisposeAfterUse::YES);
+		ConfMan.saveToStream(buffer);
+
+		Common::MemoryReadStream contents(buffer.getData(), buffer.size());
+		Common::String domains;
+		while (!contents.eos()) {
+			Common::String line = contents.readLine();
+			if (line.hasPrefix("["))
+				domains += line;
+		}
+		return domains;
+	}
+
+public:
+	void test_get_domain_order() {
+		ConfMan.registerDefault("cmtest_key", "default");
+		TS_ASSERT_EQUALS(ConfMan.get("cmtest_key"), "default");
+
+		ConfMan.addGameDomain("cmtest_game");
+		ConfMan.setActiveDomain("cmtest_game");
+
+		// The transient domain overrides the game domain, which overrides
+		// the application domain
+		ConfMan.set("cmtest_key", "app", Common::ConfigManager::kApplicationDomain);
+		TS_ASSERT_EQUALS(ConfMan.get("cmtest_key"), "app");
+		ConfMan.set("cmtest_key", "game", "cmtest_game");
+		TS_ASSERT_EQUALS(ConfMan.get("cmtest_key"), "game");
+		ConfMan.set("cmtest_key", "transient", Common::ConfigManager::kTransientDomain);
+		TS_ASSERT_EQUALS(ConfMan.get("cmtest_key"), "transient");
+
+		// Keys are not case sensitive
+		TS_ASSERT_EQUALS(ConfMan.get("CMTEST_Key"), "transient");
+		TS_ASSERT_EQUALS(ConfMan.get("cmtest_key", "cmtest_game"), "game");
+		TS_ASSERT_EQUALS(ConfMan.get("cmtest_missing", "cmtest_game"), "");
+
+		ConfMan.removeKey("cmtest_key", Common::ConfigManager::kTransientDomain);
+		ConfMan.removeKey("cmtest_key", Common::ConfigManager::kApplicationDomain);
+		ConfMan.setActiveDomain("");
+		ConfMan.removeGameDomain("cmtest_game");
+		TS_ASSERT_EQUALS(ConfMan.get("cmtest_key"), "default");
+	}
+
+	void test_int_and_bool() {
+		ConfMan.addGameDomain("cmtest_game");
+		ConfMan.setInt("cmtest_int", 0x20, "cmtest_game");
+		ConfMan.setBool("cmtest_bool", true, "cmtest_game");
+
+		TS_ASSERT_EQUALS(ConfMan.getInt("cmtest_int", "cmtest_game"), 32);
+		TS_ASSERT(ConfMan.getBool("cmtest_bool", "cmtest_game"));
+		TS_ASSERT_EQUALS(ConfMan.getInt("cmtest_missing", "cmtest_game"), 0);
+
+		ConfMan.removeGameDomain("cmtest_game");
+		TS_ASSERT(!ConfMan.hasGameDomain("cmtest_game"));
+	}
+
+	void test_key_handle() {
+		Common::ConfigManager::KeyHandle key("cmtest_handle");
+		ConfMan.registerDefault("cmtest_handle", "default");
+		TS_ASSERT_EQUALS(ConfMan.get(key), "default");
+
+		// Every change has to be seen through the handle
+		ConfMan.set("cmtest_handle", "app", Common::ConfigManager::kApplicationDomain);
+		TS_ASSERT_EQUALS(ConfMan.get(key), "app");
+		ConfMan.addGameDomain("cmtest_game");
+		ConfMan.set("cmtest_handle", "game", "cmtest_game");
+		TS_ASSERT_EQUALS(ConfMan.get(key), "app");
+		ConfMan.setActiveDomain("cmtest_game");
+		TS_ASSERT_EQUALS(ConfMan.get(key), "game");
+		ConfMan.set("cmtest_handle", "transient", Common::ConfigManager::kTransientDomain);
+		TS_ASSERT_EQUALS(ConfMan.get(key), "transient");
+		ConfMan.removeKey("cmtest_handle", Common::ConfigManager::kTransientDomain);
+		TS_ASSERT_EQUALS(ConfMan.get(key), "game");
+		ConfMan.set("cmtest_handle", "changed");
+		TS_ASSERT_EQUALS(ConfMan.get(key), "changed");
+		ConfMan.getActiveDomain()->erase("cmtest_handle");
+		TS_ASSERT_EQUALS(ConfMan.get(key), "app");
+		ConfMan.setActiveDomain("");
+		ConfMan.removeGameDomain("cmtest_game");
+		ConfMan.removeKey("cmtest_handle", Common::ConfigManager::kApplicationDomain);
+		TS_ASSERT_EQUALS(ConfMan.get(key), "default");
+
+		Common::ConfigManager::KeyHandle intKey("cmtest_int_handle");
+		Common::ConfigManager::KeyHandle boolKey("cmtest_bool_handle");
+		ConfMan.registerDefault("cmtest_int_handle", 5);
+		ConfMan.registerDefault("cmtest_bool_handle", false);
+		TS_ASSERT_EQUALS(ConfMan.getInt(intKey), 5);
+		TS_ASSERT(!ConfMan.getBool(boolKey));
+		ConfMan.setInt("cmtest_int_handle", 7);
+		ConfMan.setBool("cmtest_bool_handle", true);
+		TS_ASSERT_EQUALS(ConfMan.getInt(intKey), 7);
+		TS_ASSERT(ConfMan.getBool(boolKey));
+		ConfMan.removeKey("cmtest_int_handle", Common::ConfigManager::kApplicationDomain);
+		ConfMan.removeKey("cmtest_bool_handle", Common::ConfigManager::kApplicationDomain);
+	}
+
+	void test_save_order() {
+		loadConfig(
+			"[scummvm]\n"
+			"cmtest_app=1\n"
+			"[cmtest_b]\n"
+			"gameid=b\n"
+			"[cmtest_a]\n"
+			"gameid=a\n");
+		TS_ASSERT_EQUALS(savedDomains(), "[scummvm][cmtest_b][cmtest_a]");
+
+		// New game domains are saved last, and the ones which are there
+		// already keep their place, even when they are added again
+		ConfMan.addGameDomain("cmtest_c");
+		ConfMan.set("gameid", "c", "cmtest_c");
+		ConfMan.addGameDomain("cmtest_b");
+		ConfMan.removeGameDomain("cmtest_a");
+		TS_ASSERT_EQUALS(savedDomains(), "[scummvm][cmtest_b][cmtest_c]");
+		ConfMan.addGameDomain("cmtest_a");
+		ConfMan.set("gameid", "a", "cmtest_a");
+		TS_ASSERT_EQUALS(savedDomains(), "[scummvm][cmtest_b][cmtest_a][cmtest_c]");
+
+		loadConfig("");
+	}
+
+	void test_flush_unchanged() {
+		loadConfig(
+			"[scummvm]\n"
+			"cmtest_app=1\n"
+			"[cmtest_game]\n"
+			"gameid=game\n");
+
+		// What was just loaded does not need to be written back
+		TS_ASSERT(ConfMan.isFlushed());
+
+		ConfMan.set("cmtest_app", "2", Common::ConfigManager::kApplicationDomain);
+		TS_ASSERT(!ConfMan.isFlushed());
+		ConfMan.set("cmtest_app", "1", Common::ConfigManager::kApplicationDomain);
+		TS_ASSERT(ConfMan.isFlushed());
+
+		// Neither are settings which are not saved
+		ConfMan.set("cmtest_app", "2", Common::ConfigManager::kTransientDomain);
+		TS_ASSERT(ConfMan.isFlushed());
+		ConfMan.removeKey("cmtest_app", Common::ConfigManager::kTransientDomain);
+
+		// flushToDisk() leaves the file alone. There is no OSystem here, so
+		// opening the file would fail an assertion.
+		ConfMan.flushToDisk();
+
+		ConfMan.removeGameDomain("cmtest_game");
+		TS_ASSERT(!ConfMan.isFlushed());
+
+		loadConfig("");
+	}
+};
@@ -0,0 +1,50 @@
+#include <cxxtest/TestSuite.h>
+
+#include "engines/sci/graphics/celscale.h"
+
+// scaleCelBitmap() builds the scaled cels GfxView::drawScaled() caches.
+class SciCelScaleTestSuite : public CxxTest::TestSuite {
+private:
+	enum {
+		kCelWidth = 6,
+		kCelHeight = 4
+	};
+
+	byte _cel[kCelWidth * kCelHeight];
+
+	void fillCel() {
+		for (int i = 0; i < kCelWidth * kCelHeight; i++)
+			_cel[i] = i;
+	}
+
+public:
+	void test_unscaled() {
+		fillCel();
+		byte scaled[kCelWidth * kCelHeight];
+		Sci::scaleCelBitmap(scaled, kCelWidth, kCelHeight, _cel, kCelWidth, kCelHeight, 128, 128);
+		TS_ASSERT_SAME_DATA(scaled, _cel, sizeof(scaled));
+	}
+
+	void test_half_size() {
+		fillCel();
+		byte scaled[(kCelWidth / 2) * (kCelHeight / 2)];
+		Sci::scaleCelBitmap(scaled, kCelWidth / 2, kCelHeight / 2, _cel, kCelWidth, kCelHeight, 64, 64);
+
+		// Every other pixel of every other row
+		for (int y = 0; y < kCelHeight / 2; y++) {
+			for (int x = 0; x < kCelWidth / 2; x++)
+				TS_ASSERT_EQUALS(scaled[y * (kCelWidth / 2) + x], _cel[(y * 2) * kCelWidth + x * 2]);
+		}
+	}
+
+	void test_double_width() {
+		const byte cel[3] = { 10, 20, 30 };
+		byte scaled[6];
+		memset(scaled, 0, sizeof(scaled));
+		Sci::scaleCelBitmap(scaled, 6, 1, cel, 3, 1, 256, 128);
+
+		// The first pixel is not repeated, the last one fills up the rest
+		const byte expected[6] = { 10, 20, 20, 30, 30, 30 };
+		TS_ASSERT_SAME_DATA(scaled, expected, sizeof(scaled));
+	}
+};
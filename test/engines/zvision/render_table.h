@@ -0,0 +1,75 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/rect.h"
+#include "graphics/pixelformat.h"
+#include "graphics/surface.h"
+#include "engines/zvision/graphics/render_table.h"
+
+// RenderManager only warps the parts of the scene its dirty rect covers.
+// Removing an effect marks its screen area dirty, which has to be enough to
+// bring back the warped background without the effect.
+class ZVisionRenderTableTestSuite : public CxxTest::TestSuite {
+private:
+	enum {
+		kWidth = 640,
+		kHeight = 344
+	};
+
+	static void fillPattern(Graphics::Surface &surface) {
+		for (int y = 0; y < surface.h; ++y) {
+			for (int x = 0; x < surface.w; ++x)
+				*(uint16 *)surface.getBasePtr(x, y) = (x * 7 + y * 13) & 0x7FFF;
+		}
+	}
+
+	static bool isEqual(const Graphics::Surface &a, const Graphics::Surface &b) {
+		for (int y = 0; y < a.h; ++y) {
+			if (memcmp(a.getBasePtr(0, y), b.getBasePtr(0, y), a.w * 2))
+				return false;
+		}
+		return true;
+	}
+
+	void checkDeletedEffect(ZVision::RenderTable::RenderState state, const Common::Rect &effectRect, const Common::Rect &otherRect) {
+		const Graphics::PixelFormat format(2, 5, 5, 5, 0, 10, 5, 0, 0);
+		Graphics::Surface background, effect, warped, expected;
+		background.create(kWidth, kHeight, format);
+		effect.create(kWidth, kHeight, format);
+		warped.create(kWidth, kHeight, format);
+		expected.create(kWidth, kHeight, format);
+
+		fillPattern(background);
+		effect.copyFrom(background);
+		effect.fillRect(effectRect, 0x7C00);
+
+		ZVision::RenderTable table(kWidth, kHeight);
+		table.setRenderState(state);
+		table.generateRenderTable();
+
+		// The scene is warped with the effect drawn in
+		TS_ASSERT_EQUALS(table.mutateImage(&warped, &effect, effectRect), Common::Rect(kWidth, kHeight));
+
+		// A change elsewhere leaves the effect in the warped scene
+		table.mutateImage(&warped, &background, otherRect);
+		table.mutateImage(&expected, &background);
+		TS_ASSERT(!isEqual(warped, expected));
+
+		// Redrawing the area of the effect removes it
+		TS_ASSERT(!table.mutateImage(&warped, &background, effectRect).isEmpty());
+		TS_ASSERT(isEqual(warped, expected));
+
+		background.free();
+		effect.free();
+		warped.free();
+		expected.free();
+	}
+
+public:
+	void test_panorama_deleted_effect() {
+		checkDeletedEffect(ZVision::RenderTable::PANORAMA, Common::Rect(300, 100, 360, 160), Common::Rect(20, 20, 60, 60));
+	}
+
+	void test_tilt_deleted_effect() {
+		checkDeletedEffect(ZVision::RenderTable::TILT, Common::Rect(300, 150, 360, 200), Common::Rect(20, 20, 60, 60));
+	}
+};
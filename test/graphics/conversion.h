@@ -0,0 +1,123 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/util.h"
+#include "graphics/conversion.h"
+#include "graphics/pixelformat.h"
+#include "graphics/surface.h"
+
+// crossBlit() has specialized code for common format pairs, all of which has
+// to give the same result as converting pixel by pixel through PixelFormat.
+class ConversionTestSuite : public CxxTest::TestSuite {
+private:
+	static uint32 readPixel(const byte *src, int bytesPerPixel) {
+		if (bytesPerPixel == 2)
+			return *(const uint16 *)src;
+		else if (bytesPerPixel == 3)
+			return READ_UINT24(src);
+		else
+			return *(const uint32 *)src;
+	}
+
+	static uint32 referenceConvert(uint32 color, const Graphics::PixelFormat &dstFmt, const Graphics::PixelFormat &srcFmt) {
+		byte a, r, g, b;
+		srcFmt.colorToARGB(color, a, r, g, b);
+		return dstFmt.ARGBToColor(a, r, g, b);
+	}
+
+	static void fillRandom(byte *buffer, uint size, uint32 seed) {
+		for (uint i = 0; i < size; i++) {
+			seed = seed * 1103515245 + 12345;
+			buffer[i] = seed >> 16;
+		}
+	}
+
+	void checkConversion(const Graphics::PixelFormat &dstFmt, const Graphics::PixelFormat &srcFmt) {
+		// Odd sizes and padded pitches, so that both whole groups of pixels
+		// and leftovers get converted
+		const uint w = 37, h = 5;
+		const uint srcPitch = w * srcFmt.bytesPerPixel + 6;
+		const uint dstPitch = w * dstFmt.bytesPerPixel + 8;
+
+		byte *src = new byte[srcPitch * h];
+		byte *dst = new byte[dstPitch * h];
+		fillRandom(src, srcPitch * h, srcFmt.bytesPerPixel * 7 + dstFmt.bytesPerPixel);
+		memset(dst, 0xAB, dstPitch * h);
+
+		TS_ASSERT(Graphics::crossBlit(dst, src, dstPitch, srcPitch, w, h, dstFmt, srcFmt));
+
+		for (uint y = 0; y < h; y++) {
+			for (uint x = 0; x < w; x++) {
+				const uint32 color = readPixel(src + y * srcPitch + x * srcFmt.bytesPerPixel, srcFmt.bytesPerPixel);
+				const uint32 expected = referenceConvert(color, dstFmt, srcFmt);
+				TS_ASSERT_EQUALS(readPixel(dst + y * dstPitch + x * dstFmt.bytesPerPixel, dstFmt.bytesPerPixel), expected);
+			}
+			// The padding must stay untouched
+			for (uint x = w * dstFmt.bytesPerPixel; x < dstPitch; x++)
+				TS_ASSERT_EQUALS(dst[y * dstPitch + x], 0xAB);
+		}
+
+		delete[] src;
+		delete[] dst;
+	}
+
+	void checkInPlace(const Graphics::PixelFormat &dstFmt, const Graphics::PixelFormat &srcFmt) {
+		const int w = 29, h = 4;
+		Graphics::Surface surface;
+		surface.create(w, h, srcFmt);
+		fillRandom((byte *)surface.getPixels(), surface.pitch * h, 0x5EED);
+
+		Graphics::Surface *expected = surface.convertTo(dstFmt);
+		surface.convertToInPlace(dstFmt);
+
+		for (int y = 0; y < h; y++) {
+			for (int x = 0; x < w; x++) {
+				TS_ASSERT_EQUALS(readPixel((const byte *)surface.getBasePtr(x, y), dstFmt.bytesPerPixel),
+				                 readPixel((const byte *)expected->getBasePtr(x, y), dstFmt.bytesPerPixel));
+			}
+		}
+
+		expected->free();
+		delete expected;
+		surface.free();
+	}
+
+	static Graphics::PixelFormat format(uint i) {
+		switch (i) {
+		case 0: return Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0);    // RGB565
+		case 1: return Graphics::PixelFormat(2, 5, 6, 5, 0, 0, 5, 11, 0);    // BGR565
+		case 2: return Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0);    // RGB555
+		case 3: return Graphics::PixelFormat(2, 5, 5, 5, 1, 10, 5, 0, 15);   // ARGB1555
+		case 4: return Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);   // ARGB8888
+		case 5: return Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);   // RGBA8888
+		case 6: return Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24);   // ABGR8888
+		case 7: return Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0);   // BGRA8888
+		default: return Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0);   // XRGB8888
+		}
+	}
+
+	enum { kFormatCount = 9 };
+
+public:
+	void test_all_pairs() {
+		for (uint src = 0; src < kFormatCount; src++) {
+			for (uint dst = 0; dst < kFormatCount; dst++) {
+				if (src != dst)
+					checkConversion(format(dst), format(src));
+			}
+		}
+	}
+
+	void test_3bpp_source() {
+		const Graphics::PixelFormat rgb888(3, 8, 8, 8, 0, 16, 8, 0, 0);
+		checkConversion(format(0), rgb888);
+		checkConversion(format(4), rgb888);
+	}
+
+	void test_in_place() {
+		checkInPlace(format(4), format(0));
+		checkInPlace(format(5), format(2));
+		checkInPlace(format(0), format(6));
+		checkInPlace(format(7), format(4));
+		checkInPlace(format(8), format(3));
+	}
+};
@@ -0,0 +1,105 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/fonts/textcache.h"
+
+// Renderings which count how many of them are alive, so that the tests can
+// check that the cache deletes what it evicts.
+struct CachedText {
+	static int alive;
+	int value;
+
+	CachedText(int v) : value(v) { ++alive; }
+	~CachedText() { --alive; }
+};
+
+int CachedText::alive = 0;
+
+typedef Graphics::TextCache<int, CachedText> IntTextCache;
+
+class TextCacheTestSuite : public CxxTest::TestSuite {
+public:
+	void test_get_put() {
+		{
+			IntTextCache cache(100);
+			TS_ASSERT(!cache.get(1));
+
+			cache.put(1, new CachedText(10), 10);
+			cache.put(2, new CachedText(20), 20);
+			TS_ASSERT_EQUALS(cache.get(1)->value, 10);
+			TS_ASSERT_EQUALS(cache.get(2)->value, 20);
+			TS_ASSERT_EQUALS(cache.getSize(), 30u);
+
+			// Replacing a rendering deletes the old one
+			cache.put(1, new CachedText(11), 15);
+			TS_ASSERT_EQUALS(cache.get(1)->value, 11);
+			TS_ASSERT_EQUALS(cache.getSize(), 35u);
+			TS_ASSERT_EQUALS(CachedText::alive, 2);
+
+			cache.remove(2);
+			TS_ASSERT(!cache.get(2));
+			TS_ASSERT_EQUALS(cache.getSize(), 15u);
+			TS_ASSERT_EQUALS(CachedText::alive, 1);
+		}
+		TS_ASSERT_EQUALS(CachedText::alive, 0);
+	}
+
+	void test_evict_least_recently_used() {
+		IntTextCache cache(30);
+		cache.put(1, new CachedText(1), 10);
+		cache.put(2, new CachedText(2), 10);
+		cache.put(3, new CachedText(3), 10);
+
+		// 1 is used again, so 2 is the least recently used one now
+		cache.get(1);
+		cache.put(4, new CachedText(4), 10);
+		TS_ASSERT(cache.get(1));
+		TS_ASSERT(!cache.get(2));
+		TS_ASSERT(cache.get(3));
+		TS_ASSERT(cache.get(4));
+		TS_ASSERT_EQUALS(cache.getSize(), 30u);
+		TS_ASSERT_EQUALS(CachedText::alive, 3);
+
+		// Lowering the limit evicts right away
+		cache.setMaxSize(20);
+		TS_ASSERT_EQUALS(cache.getCount(), 2u);
+		TS_ASSERT(!cache.get(1));
+		TS_ASSERT(cache.get(3));
+		TS_ASSERT(cache.get(4));
+
+		// A rendering larger than the limit stays on its own
+		cache.put(5, new CachedText(5), 50);
+		TS_ASSERT_EQUALS(cache.getCount(), 1u);
+		TS_ASSERT(cache.get(5));
+
+		cache.clear();
+		TS_ASSERT_EQUALS(cache.getCount(), 0u);
+		TS_ASSERT_EQUALS(cache.getSize(), 0u);
+		TS_ASSERT_EQUALS(CachedText::alive, 0);
+	}
+
+	void test_purge_unused() {
+		IntTextCache cache(100);
+		cache.put(1, new CachedText(1), 10);
+		cache.put(2, new CachedText(2), 10);
+
+		// Everything was used since the cache was created
+		cache.purgeUnused();
+		TS_ASSERT_EQUALS(cache.getCount(), 2u);
+
+		cache.get(2);
+		cache.put(3, new CachedText(3), 10);
+		cache.purgeUnused();
+		TS_ASSERT_EQUALS(cache.getCount(), 2u);
+		TS_ASSERT(!cache.get(1));
+		TS_ASSERT(cache.get(2));
+		TS_ASSERT(cache.get(3));
+		TS_ASSERT_EQUALS(cache.getSize(), 20u);
+		TS_ASSERT_EQUALS(CachedText::alive, 2);
+
+		// The lookups above marked both as used again
+		cache.purgeUnused();
+		cache.purgeUnused();
+		TS_ASSERT_EQUALS(cache.getCount(), 0u);
+		TS_ASSERT_EQUALS(CachedText::alive, 0);
+	}
+};
@@ -0,0 +1,140 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/util.h"
+#include "graphics/transparent_surface.h"
+
+// Per pixel reference versions of the TransparentSurface blending modes,
+// blitting has to match these exactly whichever code path it takes.
+// Pixels are in the 0xRRGGBBAA format that TransparentSurface expects.
+class TransparentSurfaceTestSuite : public CxxTest::TestSuite {
+private:
+	static byte channel(uint32 pixel, int shift) {
+		return (pixel >> shift) & 0xFF;
+	}
+
+	static uint32 makePixel(uint r, uint g, uint b, uint a) {
+		return ((r & 0xFF) << 24) | ((g & 0xFF) << 16) | ((b & 0xFF) << 8) | (a & 0xFF);
+	}
+
+	static uint32 referenceBlend(uint32 src, uint32 dst, uint32 color, Graphics::TSpriteBlendMode blendMode) {
+		const int shifts[3] = { 24, 16, 8 };
+		const uint mods[3] = { (color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF };
+		const uint ca = color >> 24;
+		const uint a = channel(src, 0);
+		uint out[4] = { channel(dst, 24), channel(dst, 16), channel(dst, 8), channel(dst, 0) };
+
+		if (blendMode == Graphics::BLEND_NORMAL) {
+			if (color == 0xFFFFFFFF) {
+				if (a == 0)
+					return dst;
+				for (int c = 0; c < 3; c++)
+					out[c] = (channel(src, shifts[c]) * a + out[c] * (255 - a)) >> 8;
+			} else {
+				uint ina = a * ca >> 8;
+				for (int c = 0; c < 3; c++) {
+					out[c] = (out[c] * (255 - ina) >> 8) & 0xFF;
+					out[c] = (out[c] + (channel(src, shifts[c]) * ina * mods[c] >> 16)) & 0xFF;
+				}
+			}
+			out[3] = 255;
+		} else if (blendMode == Graphics::BLEND_ADDITIVE) {
+			if (color == 0xFFFFFFFF) {
+				for (int c = 0; c < 3; c++)
+					out[c] = MIN<uint>((channel(src, shifts[c]) * a >> 8) + out[c], 255);
+			} else {
+				uint ina = a * ca >> 8;
+				for (int c = 0; c < 3; c++) {
+					if (mods[c] != 255)
+						out[c] = MIN<uint>(out[c] + ((channel(src, shifts[c]) * mods[c] * ina) >> 16), 255);
+					else
+						out[c] = MIN<uint>(out[c] + (channel(src, shifts[c]) * ina >> 8), 255);
+				}
+			}
+		} else {
+			assert(color == 0xFFFFFFFF);
+			for (int c = 0; c < 3; c++)
+				out[c] = out[c] - ((channel(src, shifts[c]) * out[c]) * a >> 16);
+		}
+		return makePixel(out[0], out[1], out[2], out[3]);
+	}
+
+	void checkBlend(uint32 color, Graphics::TSpriteBlendMode blendMode, int flipping) {
+		const Graphics::PixelFormat format(4, 8, 8, 8, 8, 24, 16, 8, 0);
+		// Odd sizes so that both whole groups of pixels and leftovers get blended
+		const int w = 37, h = 5;
+
+		Graphics::TransparentSurface src;
+		src.create(w, h, format);
+		Graphics::Surface dst;
+		dst.create(w + 3, h, format);
+		uint32 *expected = new uint32[w * h];
+
+		uint32 seed = 0x1234567 ^ color ^ (blendMode << 4) ^ flipping;
+		for (int y = 0; y < h; y++) {
+			for (int x = 0; x < w; x++) {
+				seed = seed * 1103515245 + 12345;
+				uint32 s = seed;
+				// Make sure the edge cases of the alpha channel show up
+				switch ((x + y) % 7) {
+				case 0: s &= 0xFFFFFF00; break;
+				case 1: s |= 0xFF; break;
+				default: break;
+				}
+				*(uint32 *)src.getBasePtr(x, y) = s;
+			}
+			for (int x = 0; x < w + 3; x++) {
+				seed = seed * 1103515245 + 12345;
+				*(uint32 *)dst.getBasePtr(x, y) = seed ^ (seed >> 13);
+			}
+		}
+
+		for (int y = 0; y < h; y++) {
+			for (int x = 0; x < w; x++) {
+				int srcX = (flipping & Graphics::FLIP_H) ? w - 1 - x : x;
+				int srcY = (flipping & Graphics::FLIP_V) ? h - 1 - y : y;
+				expected[y * w + x] = referenceBlend(*(uint32 *)src.getBasePtr(srcX, srcY), *(uint32 *)dst.getBasePtr(x + 3, y), color, blendMode);
+			}
+		}
+
+		src.blit(dst, 3, 0, flipping, nullptr, color, -1, -1, blendMode);
+
+		for (int y = 0; y < h; y++) {
+			for (int x = 0; x < w; x++) {
+				TS_ASSERT_EQUALS(*(uint32 *)dst.getBasePtr(x + 3, y), expected[y * w + x]);
+			}
+		}
+
+		delete[] expected;
+		src.free();
+		dst.free();
+	}
+
+public:
+	void test_alpha_blend() {
+		checkBlend(0xFFFFFFFF, Graphics::BLEND_NORMAL, Graphics::FLIP_NONE);
+		checkBlend(0xFFFFFFFF, Graphics::BLEND_NORMAL, Graphics::FLIP_H);
+		checkBlend(0xFFFFFFFF, Graphics::BLEND_NORMAL, Graphics::FLIP_V);
+	}
+
+	void test_alpha_blend_color_mod() {
+		checkBlend(0x80FF40C0, Graphics::BLEND_NORMAL, Graphics::FLIP_NONE);
+		checkBlend(0xFF7F7F7F, Graphics::BLEND_NORMAL, Graphics::FLIP_H);
+		checkBlend(0x01FFFFFF, Graphics::BLEND_NORMAL, Graphics::FLIP_NONE);
+	}
+
+	void test_additive_blend() {
+		checkBlend(0xFFFFFFFF, Graphics::BLEND_ADDITIVE, Graphics::FLIP_NONE);
+		checkBlend(0xFFFFFFFF, Graphics::BLEND_ADDITIVE, Graphics::FLIP_HV);
+	}
+
+	void test_additive_blend_color_mod() {
+		checkBlend(0x80FF40C0, Graphics::BLEND_ADDITIVE, Graphics::FLIP_NONE);
+		checkBlend(0xC0FFFF00, Graphics::BLEND_ADDITIVE, Graphics::FLIP_V);
+		checkBlend(0xFFFFFFFE, Graphics::BLEND_ADDITIVE, Graphics::FLIP_H);
+	}
+
+	void test_subtractive_blend() {
+		checkBlend(0xFFFFFFFF, Graphics::BLEND_SUBTRACTIVE, Graphics::FLIP_NONE);
+		checkBlend(0xFFFFFFFF, Graphics::BLEND_SUBTRACTIVE, Graphics::FLIP_H);
+	}
+};
@@ -5,8 +5,24 @@
 #
 ######################################################################
 
-TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h
-TEST_LIBS    := audio/libaudio.a common/libcommon.a
+TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/graphics/*.h
+TEST_LIBS    := audio/libaudio.a graphics/libgraphics.a common/libcommon.a
+
+ifdef USE_OPENGL
+TESTS        += $(srcdir)/test/backends/opengl/*.h
+TEST_LIBS    := backends/graphics/opengl/texture.o backends/graphics/opengl/extensions.o \
+	backends/graphics/opengl/debug.o $(TEST_LIBS)
+endif
+
+ifdef ENABLE_ZVISION
+TESTS        += $(srcdir)/test/engines/zvision/*.h
+TEST_LIBS    := engines/zvision/graphics/render_table.o $(TEST_LIBS)
+endif
+
+ifdef ENABLE_SCI
+TESTS        += $(srcdir)/test/engines/sci/*.h
+TEST_LIBS    := engines/sci/graphics/celscale.o $(TEST_LIBS)
+endif
 
 #
 TEST_FLAGS   := --runner=StdioPrinter --no-std --no-eh --include=$(srcdir)/test/cxxtest_mingw.h